@@ -0,0 +1,114 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "sync/thread_pool.hpp"
+
+
+// Global allocator instrumentation
+// ===========================================================
+static std::atomic_size_t g_allocations = 0;
+
+void* operator new(size_t size)
+{
+    ++g_allocations;
+
+    if (void* ptr = std::malloc(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    ++g_allocations;
+
+    size_t align = static_cast<size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+// Helpers
+// ===========================================================
+constexpr size_t warmup_tasks   = 10'000;
+constexpr size_t measured_tasks = 200'000;
+constexpr size_t in_flight      = 64;
+
+
+template<class Pool>
+void _post_tasks(Pool& pool, size_t count)
+{
+    std::vector<std::future<int>> results;
+    results.reserve(in_flight);
+
+    for (size_t i = 0; i < count; i += in_flight)
+    {
+        for (size_t j = 0; j < in_flight; ++j)
+            results.push_back(sync::post(pool, [](int value) { return value + 1; }, static_cast<int>(j)));
+
+        for (auto& result : results)
+            (void)result.get();
+
+        results.clear();
+    }
+}
+
+
+template<class Pool>
+void _run_benchmark(const char* name, const sync::queue_options& options)
+{
+    Pool pool(4, options);
+
+    _post_tasks(pool, warmup_tasks);
+
+    size_t allocationsBefore    = g_allocations;
+    auto start                  = std::chrono::steady_clock::now();
+
+    _post_tasks(pool, measured_tasks);
+
+    auto elapsed                = std::chrono::steady_clock::now() - start;
+    size_t allocations          = g_allocations - allocationsBefore;
+
+    std::printf("%-40s %10.3f allocations/task %10.1f ns/task\n",
+                name,
+                static_cast<double>(allocations) / measured_tasks,
+                std::chrono::duration<double, std::nano>(elapsed).count() / measured_tasks);
+}
+
+
+int main()
+{
+    std::printf("Global allocations per task in steady state (%zu tasks, %zu in flight)\n\n", measured_tasks, in_flight);
+
+    _run_benchmark<sync::thread_pool>("thread_pool + new_delete_resource", sync::queue_options{.task_resource = std::pmr::new_delete_resource()});
+    _run_benchmark<sync::thread_pool>("thread_pool + slab_resource", sync::queue_options{});
+    _run_benchmark<sync::fifo_thread_pool>("fifo_thread_pool + new_delete_resource", sync::queue_options{.task_resource = std::pmr::new_delete_resource()});
+    _run_benchmark<sync::fifo_thread_pool>("fifo_thread_pool + slab_resource", sync::queue_options{});
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "sync/channel.hpp"
+#include "sync/thread_pool.hpp"
+
+
+// Helpers
+// ===========================================================
+constexpr size_t item_count     = 2'000'000;
+constexpr size_t capacity       = 1024;
+constexpr size_t batch_size     = 64;
+
+
+// Reference: same bounded queue with a mutex
+class _MutexQueue
+{
+private:
+    std::mutex _mtx;
+    std::deque<size_t> _items;
+    size_t _capacity;
+
+public:
+    explicit _MutexQueue(size_t capacity) : _capacity(capacity) { /*Empty*/ }
+
+    bool try_send(size_t value)
+    {
+        std::lock_guard lock(_mtx);
+
+        if (_items.size() == _capacity)
+            return false;
+
+        _items.push_back(value);
+        return true;
+    }
+
+    std::optional<size_t> try_receive()
+    {
+        std::lock_guard lock(_mtx);
+
+        if (_items.empty())
+            return std::nullopt;
+
+        size_t value = _items.front();
+        _items.pop_front();
+        return value;
+    }
+};  // END _MutexQueue
+
+
+void _print(const char* name, std::chrono::steady_clock::duration elapsed)
+{
+    double seconds = std::chrono::duration<double>(elapsed).count();
+
+    std::printf("%-45s %8.1f ns/item %8.2f M items/s\n", name, seconds * 1e9 / item_count, item_count / seconds / 1e6);
+}
+
+
+template<class Queue>
+void _run_transfer(const char* name)
+{
+    Queue queue(capacity);
+    size_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::jthread producer([&]() {
+        for (size_t i = 0; i < item_count; ++i)
+            while (!queue.try_send(i))
+                std::this_thread::yield();
+    });
+
+    for (size_t received = 0; received < item_count; )
+    {
+        if (auto value = queue.try_receive())
+        {
+            sum += *value;
+            ++received;
+        }
+        else
+            std::this_thread::yield();
+    }
+
+    producer.join();
+    _print(name, std::chrono::steady_clock::now() - start);
+}
+
+
+template<class Channel>
+void _run_batch_transfer(const char* name)
+{
+    Channel ch(capacity);
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::jthread producer([&]() {
+        std::vector<size_t> batch(batch_size);
+
+        for (size_t i = 0; i < item_count; i += batch_size)
+        {
+            for (size_t j = 0; j < batch_size; ++j)
+                batch[j] = i + j;
+
+            for (auto first = batch.begin(); first != batch.end(); )
+            {
+                size_t sent = ch.try_send_batch(first, batch.end());
+
+                if (sent == 0)
+                    std::this_thread::yield();
+
+                first += sent;
+            }
+        }
+    });
+
+    std::vector<size_t> batch;
+
+    for (size_t received = 0; received < item_count; )
+    {
+        batch.clear();
+        size_t count = ch.try_receive_batch(std::back_inserter(batch), batch_size);
+
+        if (count == 0)
+            std::this_thread::yield();
+
+        received += count;
+    }
+
+    producer.join();
+    _print(name, std::chrono::steady_clock::now() - start);
+}
+
+
+// Producer thread -> channel -> stage resumed on a thread_pool -> channel -> main thread
+template<sync::channel_mode Mode>
+void _run_pipeline(const char* name)
+{
+    sync::channel<size_t, Mode> input(capacity);
+    sync::channel<size_t, Mode> output(capacity);
+    sync::thread_pool tp(1);
+
+    std::function<void(std::optional<size_t>)> stage = [&](std::optional<size_t> value) {
+        if (!value)
+        {
+            output.close();
+            return;
+        }
+
+        size_t values[batch_size];
+        values[0]       = *value * 2;
+        size_t count    = 1 + input.try_receive_batch(values + 1, batch_size - 1);
+
+        for (size_t i = 1; i < count; ++i)
+            values[i] *= 2;
+
+        for (size_t* first = values; first != values + count; )
+        {
+            size_t sent = output.try_send_batch(first, values + count);
+
+            if (sent == 0)
+                std::this_thread::yield();
+
+            first += sent;
+        }
+
+        input.async_receive(tp, stage);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    input.async_receive(tp, stage);
+
+    std::jthread producer([&]() {
+        for (size_t i = 0; i < item_count; ++i)
+            while (!input.try_send(i))
+                std::this_thread::yield();
+
+        input.close();
+    });
+
+    for (size_t received = 0; received < item_count; )
+    {
+        if (output.try_receive())
+            ++received;
+        else
+            std::this_thread::yield();
+    }
+
+    producer.join();
+    _print(name, std::chrono::steady_clock::now() - start);
+
+    tp.join();
+}
+
+
+int main()
+{
+    std::printf("Transfer %zu items (capacity %zu, batch %zu, %u hardware threads)\n\n",
+                item_count, capacity, batch_size, std::thread::hardware_concurrency());
+
+    _run_transfer<_MutexQueue>("mutex + deque");
+    _run_transfer<sync::mpmc_channel<size_t>>("mpmc_channel  try_send/try_receive");
+    _run_transfer<sync::spsc_channel<size_t>>("spsc_channel  try_send/try_receive");
+
+    _run_batch_transfer<sync::mpmc_channel<size_t>>("mpmc_channel  batch");
+    _run_batch_transfer<sync::spsc_channel<size_t>>("spsc_channel  batch");
+
+    _run_pipeline<sync::channel_mode::mpmc>("pipeline mpmc (stage on thread_pool)");
+    _run_pipeline<sync::channel_mode::spsc>("pipeline spsc (stage on thread_pool)");
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <chrono>
+#include <cstdio>
+
+#include "sync/task_context.hpp"
+#include "sync/thread_pool.hpp"
+
+
+// Helpers
+// ===========================================================
+constexpr size_t task_count = 1'000'000;
+
+static size_t g_counter = 0;
+
+void _increment()
+{
+    ++g_counter;
+}
+
+
+template<class Submit>
+void _run_task_context(const char* name, Submit submit)
+{
+    sync::task_context tc;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < task_count; ++i)
+        submit(tc);
+
+    tc.run();
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-45s %8.1f ns/task\n", name, std::chrono::duration<double, std::nano>(elapsed).count() / task_count);
+}
+
+
+template<class Context>
+void _drain(const char* name)
+{
+    Context ctx;
+
+    for (size_t i = 0; i < task_count; ++i)
+        sync::post_detached(ctx, _increment);
+
+    // Only dequeue and execution are measured
+    auto start = std::chrono::steady_clock::now();
+
+    ctx.run();
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-45s %8.1f ns/task\n", name, std::chrono::duration<double, std::nano>(elapsed).count() / task_count);
+}
+
+
+template<class Submit>
+void _run_thread_pool(const char* name, Submit submit)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        sync::thread_pool tp(4);
+
+        for (size_t i = 0; i < task_count; ++i)
+            submit(tp);
+
+        tp.join();
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-45s %8.1f ns/task\n", name, std::chrono::duration<double, std::nano>(elapsed).count() / task_count);
+}
+
+
+int main()
+{
+    std::printf("Submit and execute %zu empty tasks\n\n", task_count);
+
+    _run_task_context("task_context  sync::post()",            [](sync::task_context& tc) { (void)sync::post(tc, _increment); });
+    _run_task_context("task_context  sync::post_detached()",   [](sync::task_context& tc) { sync::post_detached(tc, _increment); });
+
+    _drain<sync::task_context>("task_context  run() of a full queue");
+    _drain<sync::fifo_task_context>("fifo_task_context  run() of a full queue");
+
+    _run_thread_pool("thread_pool   sync::post()",             [](sync::thread_pool& tp) { (void)sync::post(tp, []() {}); });
+    _run_thread_pool("thread_pool   sync::post_detached()",    [](sync::thread_pool& tp) { sync::post_detached(tp, []() {}); });
+    _run_thread_pool("thread_pool   sync::post_detached() 64 keys",
+                     [key = size_t(0)](sync::thread_pool& tp) mutable { sync::post_detached(tp, sync::affinity(key++ % 64), []() {}); });
+
+    // Chain of continuations: each task submits the next one from the worker
+    sync::task_context tc;
+    size_t remaining = task_count;
+
+    std::function<void()> chain_post = [&]() { if (--remaining > 0) sync::post_detached(tc, chain_post); };
+    std::function<void()> chain_defer = [&]() { if (--remaining > 0) sync::defer(tc, chain_defer); };
+
+    for (auto* chain : {&chain_post, &chain_defer})
+    {
+        remaining = task_count;
+        auto start = std::chrono::steady_clock::now();
+
+        sync::post_detached(tc, *chain);
+        tc.run();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::printf("%-45s %8.1f ns/task\n",
+                    chain == &chain_post ? "task_context  chain with sync::post_detached()" : "task_context  chain with sync::defer()",
+                    std::chrono::duration<double, std::nano>(elapsed).count() / task_count);
+    }
+
+    return 0;
+}
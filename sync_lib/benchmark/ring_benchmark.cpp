@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "sync/thread_pool.hpp"
+
+
+// Helpers
+// ===========================================================
+constexpr size_t task_count = 400'000;
+constexpr size_t capacity   = 4096;
+
+
+// `threads` producers post empty tasks to a pool of `threads` workers, full queue blocks the producers
+template<class Pool>
+double _run_pool(size_t threads)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    {
+        Pool tp(threads, sync::queue_options{.capacity = capacity, .overflow = sync::overflow_policy::block});
+        std::vector<std::jthread> producers;
+
+        for (size_t p = 0; p < threads; ++p)
+            producers.emplace_back([&tp, count = task_count / threads]() {
+                for (size_t i = 0; i < count; ++i)
+                    sync::post_detached(tp, []() {});
+            });
+
+        producers.clear();
+        tp.join();
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / task_count;
+}
+
+
+int main()
+{
+    std::printf("Post and execute %zu empty tasks, N producers and N workers, capacity %zu (ns/task)\n\n", task_count, capacity);
+    std::printf("%8s %16s %16s %16s %16s\n", "threads", "fifo (mutex)", "fifo_ring", "priority (mutex)", "ring");
+
+    for (size_t threads : {1, 2, 4, 8, 16, 32, 64})
+    {
+        std::printf("%8zu %16.1f %16.1f %16.1f %16.1f\n", threads,
+                    _run_pool<sync::fifo_thread_pool>(threads),
+                    _run_pool<sync::fifo_ring_thread_pool>(threads),
+                    _run_pool<sync::thread_pool>(threads),
+                    _run_pool<sync::ring_thread_pool>(threads));
+    }
+
+    return 0;
+}
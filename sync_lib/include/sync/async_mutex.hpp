@@ -0,0 +1,77 @@
+#ifndef SYNC_ASYNC_MUTEX_HPP
+#define SYNC_ASYNC_MUTEX_HPP
+
+#include "sync/async_semaphore.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Mutual exclusion for tasks: waiting for the lock doesn't block a worker thread.
+ * A contended `async_lock()` queues its handler, posted to its execution context when the lock is handed over.
+ * @note An uncontended lock is one atomic operation, its handler runs inline if called from a task on the same context
+ * @note The lock is not owned by a thread: `unlock()` can be called from any thread, including another task
+ */
+class async_mutex
+{
+private:
+    // One permit
+    async_semaphore _semaphore{1};
+
+public:
+
+    async_mutex() = default;
+
+    async_mutex(const async_mutex&)             = delete;
+    async_mutex& operator=(const async_mutex&)  = delete;
+
+public:
+
+    /**
+     * @brief Take the lock if free, without waiting
+     */
+    bool try_lock() noexcept
+    {
+        return _semaphore.try_acquire();
+    }
+
+    /**
+     * @brief Take the lock, then run `handler` on `context` (as a detached task) while holding it.
+     * The handler (or code it hands the lock to) must call `unlock()`.
+     * @param prio Optional: priority of the handler task
+     * @throw `std::system_error` if the context executor is stopped or rejects the task (the lock is not kept)
+     */
+    template<class Handler>
+    void async_lock(execution_context& context, priority prio, Handler&& handler)
+    {
+        _semaphore.async_acquire(context, prio, std::forward<Handler>(handler));
+    }
+
+    template<class Handler>
+    void async_lock(execution_context& context, Handler&& handler)
+    {
+        _semaphore.async_acquire(context, std::forward<Handler>(handler));
+    }
+
+    /**
+     * @brief Release the lock, the oldest waiting handler gets it
+     */
+    void unlock()
+    {
+        _semaphore.release();
+    }
+
+    /**
+     * @brief Returns `true` if the lock is held
+     */
+    bool locked() const noexcept
+    {
+        return _semaphore.available() == 0;
+    }
+};  // END async_mutex
+
+
+SYNC_END
+
+#endif  // SYNC_ASYNC_MUTEX_HPP
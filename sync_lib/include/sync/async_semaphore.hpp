@@ -0,0 +1,158 @@
+#ifndef SYNC_ASYNC_SEMAPHORE_HPP
+#define SYNC_ASYNC_SEMAPHORE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "sync/execution_context.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Counting semaphore that never blocks a thread.
+ * A waiting acquirer leaves a handler, posted to its execution context when a permit is released to it.
+ * @note Taking a free permit is one atomic operation. The waiter list is locked only when acquirers wait.
+ * @note Waiters are served in arrival order
+ * @note If the context of a waiting handler no longer accepts tasks, the handler is dropped and its permit goes to the next waiter.
+ * The error goes to `queue_options::exception_handler` of that context.
+ */
+class async_semaphore
+{
+private:
+    // Handler waiting for a permit
+    struct _Waiter
+    {
+        basic_executor* executor;
+        detail::priority_job job;
+    };
+
+    // Free permits if positive, otherwise minus the number of waiting acquirers
+    std::atomic<int64_t> _count;
+
+    // Guards the waiting state
+    std::mutex _waitersMtx;
+
+    // Handlers waiting for a permit, oldest first
+    std::deque<_Waiter> _waiters;
+
+    // Permits released to acquirers that did not reach `_waiters` yet
+    size_t _pendingGrants = 0;
+
+public:
+
+    /**
+     * @param permits initial number of free permits
+     */
+    SYNC_DECL explicit async_semaphore(size_t permits);
+
+    async_semaphore(const async_semaphore&)             = delete;
+    async_semaphore& operator=(const async_semaphore&)  = delete;
+
+public:
+
+    /**
+     * @brief Take a permit if one is free, without waiting
+     */
+    SYNC_DECL bool try_acquire() noexcept;
+
+    /**
+     * @brief Take a permit, then run `handler` on `context` (as a detached task) while holding it.
+     * The handler (or code it hands the permit to) must call `release()`.
+     * @param prio Optional: priority of the handler task
+     * @throw `std::system_error` if the context executor is stopped or rejects the task (no permit is kept)
+     * @note Called from a task running on `context` with a permit free, the handler runs inline as with `sync::dispatch()`:
+     * one atomic operation and no queueing. Elsewhere the handler task is posted, which costs the stop check and the
+     * post of the context (one scheduler lock each for the mutex based policies).
+     */
+    template<class Handler>
+    void async_acquire(execution_context& context, priority prio, Handler&& handler);
+
+    template<class Handler>
+    void async_acquire(execution_context& context, Handler&& handler);
+
+    /**
+     * @brief Return `n` permits, waiting handlers are served first
+     */
+    SYNC_DECL void release(size_t n = 1);
+
+    /**
+     * @brief Number of free permits (0 while acquirers wait)
+     */
+    SYNC_DECL size_t available() const noexcept;
+
+private:
+
+    /**
+     * @brief Slow path of `async_acquire()`: no permit was free
+     */
+    SYNC_DECL void _wait(basic_executor& executor, detail::priority_job&& job);
+
+    /**
+     * @brief Post the handler of an acquirer that got a permit. A refused handler is reported to its context.
+     */
+    SYNC_DECL void _grant(basic_executor& executor, detail::priority_job&& job);
+};  // END async_semaphore
+
+
+template<class Handler>
+void async_semaphore::async_acquire(execution_context& context, priority prio, Handler&& handler)
+{
+    basic_executor& executor = context.get_executor();
+
+    // Already on `context`: the calling task is still running, the handler can run inline without queueing
+    if (executor.running_in_this_thread() && try_acquire())
+    {
+        detail::job_function inlineJob(std::allocator_arg, executor.get_memory_resource(),
+                                       std::in_place_type<detail::detached_binder<Handler>>, std::forward<Handler>(handler));
+
+        try
+        {
+            executor.dispatch(detail::priority_job(prio, std::move(inlineJob)));
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+
+        return;
+    }
+
+    detail::priority_job job(prio, detail::make_detached_job(executor, std::forward<Handler>(handler)));
+
+    if (_count.fetch_sub(1, std::memory_order_acq_rel) <= 0)
+    {
+        _wait(executor, std::move(job));
+        return;
+    }
+
+    try
+    {
+        executor.post(std::move(job));
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+
+template<class Handler>
+void async_semaphore::async_acquire(execution_context& context, Handler&& handler)
+{
+    async_acquire(context, priority::medium, std::forward<Handler>(handler));
+}
+
+
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/async_semaphore.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_ASYNC_SEMAPHORE_HPP
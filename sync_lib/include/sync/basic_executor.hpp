@@ -1,7 +1,9 @@
 #ifndef SYNC_BASIC_EXECUTOR_HPP
 #define SYNC_BASIC_EXECUTOR_HPP
 
+#include <exception>
 #include <memory>
+#include <memory_resource>
 
 #include "sync/detail/priority_job.hpp"
 #include "sync/detail/binder.hpp"
@@ -15,7 +17,13 @@ class basic_executor
 public:
     virtual ~basic_executor() = default;
     virtual void post(detail::priority_job&& job) = 0;
+    virtual bool try_post(detail::priority_job&& job) = 0;
+    virtual void defer(detail::priority_job&& job) = 0;
+    virtual void dispatch(detail::priority_job&& job) = 0;
     virtual bool stopped() const = 0;
+    virtual bool running_in_this_thread() const = 0;
+    virtual std::pmr::memory_resource* get_memory_resource() const = 0;
+    virtual void report_exception(std::exception_ptr error) = 0;
 };  // END basic_executor
 
 
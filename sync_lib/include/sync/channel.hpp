@@ -0,0 +1,167 @@
+#ifndef SYNC_CHANNEL_HPP
+#define SYNC_CHANNEL_HPP
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+#include "sync/detail/mpmc_ring.hpp"
+#include "sync/detail/spsc_ring.hpp"
+#include "sync/execution_context.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Number of threads allowed on each side of a `sync::channel`
+ */
+enum class channel_mode : uint8_t
+{
+    spsc,   // one sender and one receiver at a time
+    mpmc    // any number of senders and receivers
+};  // END channel_mode
+
+
+/**
+ * @brief Bounded lock-free queue of values between pipeline stages.
+ * Senders never block: a full channel refuses the value. Receivers poll with `try_receive()`
+ * or register a handler with `async_receive()`, resumed on an execution context when a value arrives.
+ * @tparam T nothrow movable and default constructible value type
+ * @tparam Mode `channel_mode::spsc` uses a cheaper ring, but allows one sender and one receiver (including `async_receive()`)
+ * @note Sending or receiving takes no lock. A send checks for waiting handlers with one fence and one atomic load.
+ * @note The channel must outlive the handlers registered with `async_receive()`
+ */
+template<class T, channel_mode Mode = channel_mode::mpmc>
+class channel
+{
+private:
+    static_assert(std::is_default_constructible_v<T>, "channel requires a default constructible value type");
+
+    using _Ring = std::conditional_t<Mode == channel_mode::spsc, detail::spsc_ring<T>, detail::mpmc_ring<T>>;
+
+    // Handler waiting for a value
+    struct _Receiver
+    {
+        execution_context* context;
+        priority prio;
+        std::function<void(std::optional<T>)> handler;
+    };
+
+    // Values
+    _Ring _ring;
+
+    // Set by `close()`
+    std::atomic_bool _closed = false;
+
+    // Number of registered handlers, read by senders without lock
+    alignas(detail::cache_line_size) std::atomic_size_t _receiverCount = 0;
+
+    // Guards `_receivers`
+    std::mutex _receiversMtx;
+
+    // Handlers waiting for a value, oldest first
+    std::deque<_Receiver> _receivers;
+
+public:
+
+    /**
+     * @param capacity minimum number of values held (rounded up to a power of 2)
+     */
+    explicit channel(size_t capacity);
+
+    channel(const channel&)             = delete;
+    channel& operator=(const channel&)  = delete;
+
+public:
+
+    /**
+     * @brief Send a value without blocking
+     * @return `false` if the channel is full or closed (`value` is left untouched)
+     */
+    bool try_send(T&& value);
+    bool try_send(const T& value);
+
+    /**
+     * @brief Move values from `[first, last)` until the channel is full. Waiting handlers are checked once.
+     * @return Number of values sent, from `first`
+     */
+    template<class ForwardIt>
+    size_t try_send_batch(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief Receive a value without blocking
+     * @return The oldest value, empty if none
+     */
+    std::optional<T> try_receive();
+
+    /**
+     * @brief Move up to `maxCount` values to `out`
+     * @return Number of values received
+     */
+    template<class OutputIt>
+    size_t try_receive_batch(OutputIt out, size_t maxCount);
+
+    /**
+     * @brief Call `handler` with the next value, as a detached task posted to `context`.
+     * The handler gets an empty value if the channel is closed and drained.
+     * @param prio Optional: priority of the handler task
+     * @note One call receives one value; call again from the handler to keep the stage running
+     * @note The value is taken by the handler task, a task refused by `context` leaves it in the channel
+     * @note A waiting handler refused by `context` when a value arrives is dropped, the error goes to
+     * `queue_options::exception_handler` of the context
+     * @throw `std::system_error` if a value is ready (or the channel closed) and `context` refuses the task (stopped or full)
+     */
+    void async_receive(execution_context& context, priority prio, std::function<void(std::optional<T>)> handler);
+    void async_receive(execution_context& context, std::function<void(std::optional<T>)> handler);
+
+    /**
+     * @brief Refuse further sends. Values already sent can still be received, then handlers get an empty value.
+     */
+    void close();
+
+    bool closed() const;
+
+    size_t capacity() const;
+
+    /**
+     * @brief Number of values, exact only if no send or receive is in progress
+     */
+    size_t size_approx() const;
+
+private:
+
+    /**
+     * @brief Resume up to `count` handlers, oldest first. Called after `count` values were sent.
+     */
+    void _notify_receivers(size_t count);
+
+    /**
+     * @brief Post the handler task: it takes a value, or registers again if another receiver was faster
+     * @throw `std::system_error` if the context refuses the task
+     */
+    void _post_resume(_Receiver&& receiver);
+
+    /**
+     * @brief `_post_resume()` for a waiting handler. A refused task goes to the exception handler of its context.
+     */
+    void _resume(_Receiver&& receiver);
+};  // END channel
+
+
+template<class T>
+using spsc_channel = channel<T, channel_mode::spsc>;
+
+template<class T>
+using mpmc_channel = channel<T, channel_mode::mpmc>;
+
+
+SYNC_END
+
+#include "sync/detail/impl/channel.ipp"
+
+#endif  // SYNC_CHANNEL_HPP
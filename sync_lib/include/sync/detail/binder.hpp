@@ -57,6 +57,23 @@ public:
         :   _functor(std::forward<Functor>(func)),
             _boundArgs(std::forward<Args>(args)...) { /*Empty*/ }
 
+    /**
+     * @brief Construct a new binder object. The promise shared state uses the given allocator.
+     * @param alloc allocator for the promise shared state
+     * @param func functio object to be called
+     * @param args arguments for the call
+     */
+    template<class Alloc>
+    binder(std::allocator_arg_t, const Alloc& alloc, Functor&& func, Args&&... args)
+        :   _functor(std::forward<Functor>(func)),
+            _boundArgs(std::forward<Args>(args)...),
+            _promise(std::allocator_arg, alloc) { /*Empty*/ }
+
+    /**
+     * @brief Allow move (job storage may relocate the binder)
+     */
+    binder(binder&&) = default;
+
     /**
      * @brief Perform call `func(args...)`
      * @note Call `get_future()` to get the `std::future` object for call result
@@ -71,6 +88,49 @@ public:
 };  // END binder
 
 
+/**
+ * @brief Class to store a functor and its arguments when the result is not needed
+ * @tparam Functor type of the function object
+ * @tparam Args types of the arguments of the function object
+ * @note Exceptions are not captured, they propagate to the executor
+ */
+template<class Functor, class... Args>
+class detached_binder
+{
+private:
+
+    // Stored functor
+    std::decay_t<Functor> _functor;
+
+    // Stored arguments as tuple
+    std::tuple<std::decay_t<Args>...> _boundArgs;
+
+public:
+
+    detached_binder() = delete;
+    ~detached_binder() = default;
+
+    /**
+     * @brief Construct a new detached_binder object by forwarding functor and arguments
+     * @param func functio object to be called
+     * @param args arguments for the call
+     */
+    explicit detached_binder(Functor&& func, Args&&... args)
+        :   _functor(std::forward<Functor>(func)),
+            _boundArgs(std::forward<Args>(args)...) { /*Empty*/ }
+
+    /**
+     * @brief Allow move (job storage may relocate the binder)
+     */
+    detached_binder(detached_binder&&) = default;
+
+    /**
+     * @brief Perform call `func(args...)` and discard the result
+     */
+    void operator()(void);
+};  // END detached_binder
+
+
 DETAIL_END
 SYNC_END
 
@@ -0,0 +1,104 @@
+#ifndef SYNC_DETAIL_CALL_STACK_HPP
+#define SYNC_DETAIL_CALL_STACK_HPP
+
+#include <vector>
+
+#include "sync/detail/priority_job.hpp"
+
+
+SYNC_BEGIN
+
+
+class basic_executor;
+
+
+DETAIL_BEGIN
+
+
+/**
+ * @brief Per-thread stack of the executors whose `run()` is active on the calling thread
+ */
+class call_stack
+{
+public:
+
+    // Maximum number of nested inline `sync::dispatch()` calls on a frame, deeper calls are queued
+    static constexpr size_t max_dispatch_depth = 64;
+
+    /**
+     * @brief Frame pushed for the lifetime of a `run()` call
+     */
+    class frame
+    {
+    private:
+        // Executor running on this thread
+        const basic_executor* _executor;
+
+        // Frame of an enclosing `run()` on the same thread (nested contexts)
+        frame* _next;
+
+        // Continuations submitted with `sync::defer()` by the current job
+        std::vector<priority_job> _deferredJobs;
+
+        // Number of nested inline `sync::dispatch()` calls
+        size_t _dispatchDepth = 0;
+
+        friend class call_stack;
+
+    public:
+
+        SYNC_DECL explicit frame(const basic_executor* executor);
+        SYNC_DECL ~frame();
+
+        frame(const frame&)             = delete;
+        frame& operator=(const frame&)  = delete;
+
+    public:
+
+        /**
+         * @brief Append a continuation, executed after the current job returns
+         */
+        SYNC_DECL void defer(priority_job&& job);
+
+        /**
+         * @brief Returns `true` if continuations are waiting
+         */
+        SYNC_DECL bool has_deferred() const;
+
+        /**
+         * @brief Move out the waiting continuations (submission order)
+         */
+        SYNC_DECL void take_deferred(std::vector<priority_job>& jobs);
+
+        /**
+         * @brief Start an inline dispatch
+         * @return `false` if `max_dispatch_depth` is reached (nothing changes)
+         */
+        SYNC_DECL bool enter_dispatch() noexcept;
+
+        /**
+         * @brief End an inline dispatch started with `enter_dispatch()`
+         */
+        SYNC_DECL void leave_dispatch() noexcept;
+    };  // END frame
+
+public:
+
+    /**
+     * @brief Return the innermost frame of `executor` on the calling thread, `nullptr` if not running here
+     */
+    SYNC_DECL static frame* find(const basic_executor* executor) noexcept;
+
+private:
+    SYNC_DECL static frame*& _top() noexcept;
+};  // END call_stack
+
+
+DETAIL_END
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/call_stack.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_DETAIL_CALL_STACK_HPP
@@ -30,7 +30,11 @@ inline void __Assert(bool expr, const char* msg, const char* expected, const cha
 #endif
 
 
-#define SYNC_HEADER_ONLY 1  // may change in the future
+// Define SYNC_SEPARATE_COMPILATION (done by the `Sync_Library_Compiled` target) to link the
+// non-template code from the compiled library instead of including it in every translation unit
+#ifndef SYNC_SEPARATE_COMPILATION
+#   define SYNC_HEADER_ONLY 1
+#endif  // SYNC_SEPARATE_COMPILATION
 
 #ifdef SYNC_HEADER_ONLY
 #   define SYNC_DECL inline
@@ -47,4 +51,14 @@ inline void __Assert(bool expr, const char* msg, const char* expected, const cha
 #define SYNC_BEGIN namespace sync {
 #define SYNC_END }
 
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+// Alignment that keeps data written by different threads on separate cache lines
+constexpr size_t cache_line_size = 64;
+
+DETAIL_END
+SYNC_END
+
 #endif  // SYNC_DETAIL_CORE_HPP
\ No newline at end of file
@@ -0,0 +1,129 @@
+#ifndef SYNC_DETAIL_EPOLL_REACTOR_HPP
+#define SYNC_DETAIL_EPOLL_REACTOR_HPP
+
+#if defined(__linux__)
+#   define SYNC_HAS_EPOLL 1
+#endif  // __linux__
+
+#ifdef SYNC_HAS_EPOLL
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "sync/detail/priority_job.hpp"
+#include "sync/io_event.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief File descriptor readiness demultiplexer (epoll + eventfd for wake-ups).
+ * Ready descriptors are turned into jobs, executed by the scheduler that owns the reactor.
+ * @note Descriptors are registered one-shot: at most one handler call per descriptor is pending or running.
+ * The descriptor is armed again after its handler returns, until `unwatch()`.
+ */
+class epoll_reactor
+{
+private:
+    // Registered descriptor
+    struct _Watch
+    {
+        int fd;
+        io_event events;
+        priority prio;
+        std::function<void(io_event)> handler;
+        std::atomic_bool active = true;
+    };
+
+    // Maximum number of events read by one `poll()`
+    static constexpr int _max_events = 64;
+
+    // epoll instance
+    int _epollFd = -1;
+
+    // Counter used to interrupt a blocking `poll()`
+    int _eventFd = -1;
+
+    // Guards `_watches`
+    mutable std::mutex _watchesMtx;
+
+    // Registered descriptors
+    std::unordered_map<int, std::shared_ptr<_Watch>> _watches;
+
+    // Number of registered descriptors (read without lock by the scheduler)
+    std::atomic_size_t _watchCount = 0;
+
+public:
+
+    /**
+     * @throw `std::system_error` if the epoll or eventfd descriptors cannot be created
+     */
+    SYNC_DECL epoll_reactor();
+
+    SYNC_DECL ~epoll_reactor();
+
+    epoll_reactor(const epoll_reactor&)             = delete;
+    epoll_reactor& operator=(const epoll_reactor&)  = delete;
+
+public:
+
+    /**
+     * @brief Register `fd`. `handler` is called (as a job of priority `prio`) each time `fd` is ready.
+     * @throw `std::system_error` if `fd` is invalid or already registered
+     */
+    SYNC_DECL void watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler);
+
+    /**
+     * @brief Remove `fd`. A handler call already queued is skipped, one already running completes.
+     * @return `false` if `fd` was not registered
+     */
+    SYNC_DECL bool unwatch(int fd);
+
+    /**
+     * @brief Number of registered descriptors
+     */
+    SYNC_DECL size_t watch_count() const noexcept;
+
+    /**
+     * @brief Wait for ready descriptors and append their handler jobs to `jobs`
+     * @param timeoutMs maximum wait in milliseconds, -1 for no limit, 0 to return immediately
+     * @return Number of jobs appended
+     */
+    SYNC_DECL size_t poll(int timeoutMs, std::vector<priority_job>& jobs);
+
+    /**
+     * @brief Make a blocking `poll()` return
+     */
+    SYNC_DECL void interrupt() noexcept;
+
+private:
+
+    /**
+     * @brief Arm the descriptor again, if still registered
+     */
+    SYNC_DECL void _rearm(const std::shared_ptr<_Watch>& watch) noexcept;
+
+    /**
+     * @brief Convert `io_event` flags to epoll flags and back
+     */
+    SYNC_DECL static uint32_t _to_epoll(io_event events) noexcept;
+    SYNC_DECL static io_event _from_epoll(uint32_t events) noexcept;
+};  // END epoll_reactor
+
+
+DETAIL_END
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/epoll_reactor.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_HAS_EPOLL
+
+#endif  // SYNC_DETAIL_EPOLL_REACTOR_HPP
@@ -0,0 +1,103 @@
+#ifndef SYNC_DETAIL_IMPL_ASYNC_SEMAPHORE_IPP
+#define SYNC_DETAIL_IMPL_ASYNC_SEMAPHORE_IPP
+
+#include <algorithm>
+
+#include "sync/async_semaphore.hpp"
+
+
+SYNC_BEGIN
+
+
+async_semaphore::async_semaphore(size_t permits)
+    : _count(static_cast<int64_t>(permits))
+{
+    // Empty
+}
+
+
+bool async_semaphore::try_acquire() noexcept
+{
+    int64_t count = _count.load(std::memory_order_relaxed);
+
+    while (count > 0)
+    {
+        if (_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+
+void async_semaphore::release(size_t n)
+{
+    int64_t previous = _count.fetch_add(static_cast<int64_t>(n), std::memory_order_acq_rel);
+
+    if (previous >= 0)
+        return;     // nobody waits
+
+    size_t grants = std::min(n, static_cast<size_t>(-previous));
+
+    while (grants-- > 0)
+    {
+        std::unique_lock lock(_waitersMtx);
+
+        if (_waiters.empty())
+        {
+            // The acquirer counted itself but is not queued yet, it takes the permit in `_wait()`
+            ++_pendingGrants;
+            continue;
+        }
+
+        _Waiter waiter = std::move(_waiters.front());
+        _waiters.pop_front();
+        lock.unlock();
+
+        _grant(*waiter.executor, std::move(waiter.job));
+    }
+}
+
+
+size_t async_semaphore::available() const noexcept
+{
+    return static_cast<size_t>(std::max(_count.load(std::memory_order_relaxed), int64_t(0)));
+}
+
+
+void async_semaphore::_wait(basic_executor& executor, detail::priority_job&& job)
+{
+    std::unique_lock lock(_waitersMtx);
+
+    if (_pendingGrants == 0)
+    {
+        _waiters.push_back(_Waiter{&executor, std::move(job)});
+        return;
+    }
+
+    --_pendingGrants;
+    lock.unlock();
+
+    _grant(executor, std::move(job));
+}
+
+
+void async_semaphore::_grant(basic_executor& executor, detail::priority_job&& job)
+{
+    try
+    {
+        executor.post(std::move(job));
+    }
+    catch (...)
+    {
+        // Handler dropped: its context reports it, the permit goes on
+        executor.report_exception(std::current_exception());
+        release();
+    }
+}
+
+
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_ASYNC_SEMAPHORE_IPP
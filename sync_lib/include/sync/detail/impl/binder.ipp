@@ -34,6 +34,13 @@ std::future<typename binder<Functor, Args...>::return_type> binder<Functor, Args
 }
 
 
+template<class Functor, class... Args>
+void detached_binder<Functor, Args...>::operator()(void)
+{
+    (void)std::apply(_functor, _boundArgs);
+}
+
+
 DETAIL_END
 SYNC_END
 
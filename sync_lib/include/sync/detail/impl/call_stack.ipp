@@ -0,0 +1,81 @@
+#ifndef SYNC_DETAIL_IMPL_CALL_STACK_IPP
+#define SYNC_DETAIL_IMPL_CALL_STACK_IPP
+
+#include "sync/detail/call_stack.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+call_stack::frame::frame(const basic_executor* executor)
+    :   _executor(executor),
+        _next(call_stack::_top())
+{
+    call_stack::_top() = this;
+}
+
+
+call_stack::frame::~frame()
+{
+    call_stack::_top() = _next;
+}
+
+
+void call_stack::frame::defer(priority_job&& job)
+{
+    _deferredJobs.push_back(std::move(job));
+}
+
+
+bool call_stack::frame::has_deferred() const
+{
+    return !_deferredJobs.empty();
+}
+
+
+void call_stack::frame::take_deferred(std::vector<priority_job>& jobs)
+{
+    jobs.clear();
+    jobs.swap(_deferredJobs);
+}
+
+
+bool call_stack::frame::enter_dispatch() noexcept
+{
+    if (_dispatchDepth >= max_dispatch_depth)
+        return false;
+
+    ++_dispatchDepth;
+    return true;
+}
+
+
+void call_stack::frame::leave_dispatch() noexcept
+{
+    --_dispatchDepth;
+}
+
+
+call_stack::frame* call_stack::find(const basic_executor* executor) noexcept
+{
+    for (frame* current = _top(); current != nullptr; current = current->_next)
+        if (current->_executor == executor)
+            return current;
+
+    return nullptr;
+}
+
+
+call_stack::frame*& call_stack::_top() noexcept
+{
+    static thread_local frame* top = nullptr;
+    return top;
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_CALL_STACK_IPP
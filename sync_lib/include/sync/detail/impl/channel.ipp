@@ -0,0 +1,220 @@
+#ifndef SYNC_DETAIL_IMPL_CHANNEL_IPP
+#define SYNC_DETAIL_IMPL_CHANNEL_IPP
+
+#include <system_error>
+#include <vector>
+
+#include "sync/channel.hpp"
+
+
+SYNC_BEGIN
+
+
+template<class T, channel_mode Mode>
+channel<T, Mode>::channel(size_t capacity)
+    : _ring(capacity)
+{
+    // Empty
+}
+
+
+template<class T, channel_mode Mode>
+bool channel<T, Mode>::try_send(T&& value)
+{
+    if (_closed.load(std::memory_order_relaxed))
+        return false;
+
+    if (!_ring.try_push(std::move(value)))
+        return false;
+
+    _notify_receivers(1);
+    return true;
+}
+
+
+template<class T, channel_mode Mode>
+bool channel<T, Mode>::try_send(const T& value)
+{
+    T copy(value);
+    return try_send(std::move(copy));
+}
+
+
+template<class T, channel_mode Mode>
+template<class ForwardIt>
+size_t channel<T, Mode>::try_send_batch(ForwardIt first, ForwardIt last)
+{
+    if (_closed.load(std::memory_order_relaxed))
+        return 0;
+
+    size_t sent = _ring.try_push_batch(first, static_cast<size_t>(std::distance(first, last)));
+
+    if (sent > 0)
+        _notify_receivers(sent);
+
+    return sent;
+}
+
+
+template<class T, channel_mode Mode>
+std::optional<T> channel<T, Mode>::try_receive()
+{
+    T value;
+
+    if (!_ring.try_pop(value))
+        return std::nullopt;
+
+    return std::optional<T>(std::move(value));
+}
+
+
+template<class T, channel_mode Mode>
+template<class OutputIt>
+size_t channel<T, Mode>::try_receive_batch(OutputIt out, size_t maxCount)
+{
+    return _ring.try_pop_batch(out, maxCount);
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::async_receive(execution_context& context, priority prio, std::function<void(std::optional<T>)> handler)
+{
+    _Receiver receiver{&context, prio, std::move(handler)};
+
+    {
+        std::lock_guard lock(_receiversMtx);
+
+        _receivers.push_back(std::move(receiver));
+        _receiverCount.fetch_add(1, std::memory_order_seq_cst);
+
+        // Pairs with the fence in `_notify_receivers()`: a concurrent sender sees the handler or this check sees the value
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (_ring.size_approx() == 0 && !_closed.load(std::memory_order_acquire))
+            return;     // wait for a sender
+
+        receiver = std::move(_receivers.back());
+        _receivers.pop_back();
+        _receiverCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // The task takes the value, nothing is lost if the context refuses it
+    _post_resume(std::move(receiver));
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::async_receive(execution_context& context, std::function<void(std::optional<T>)> handler)
+{
+    async_receive(context, priority::medium, std::move(handler));
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::close()
+{
+    std::deque<_Receiver> receivers;
+
+    _closed.store(true, std::memory_order_seq_cst);
+
+    {
+        std::lock_guard lock(_receiversMtx);
+        receivers.swap(_receivers);
+        _receiverCount.store(0, std::memory_order_relaxed);
+    }
+
+    for (auto& receiver : receivers)
+        _resume(std::move(receiver));
+}
+
+
+template<class T, channel_mode Mode>
+bool channel<T, Mode>::closed() const
+{
+    return _closed.load(std::memory_order_acquire);
+}
+
+
+template<class T, channel_mode Mode>
+size_t channel<T, Mode>::capacity() const
+{
+    return _ring.capacity();
+}
+
+
+template<class T, channel_mode Mode>
+size_t channel<T, Mode>::size_approx() const
+{
+    return _ring.size_approx();
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::_notify_receivers(size_t count)
+{
+    // Pairs with the fence in `async_receive()`
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_receiverCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    std::vector<_Receiver> receivers;
+
+    {
+        std::lock_guard lock(_receiversMtx);
+
+        while (count-- > 0 && !_receivers.empty())
+        {
+            receivers.push_back(std::move(_receivers.front()));
+            _receivers.pop_front();
+        }
+
+        _receiverCount.store(_receivers.size(), std::memory_order_relaxed);
+    }
+
+    for (auto& receiver : receivers)
+        _resume(std::move(receiver));
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::_post_resume(_Receiver&& receiver)
+{
+    execution_context& context  = *receiver.context;
+    priority prio               = receiver.prio;
+
+    auto resumeJob = [this, &context, prio, handler = std::move(receiver.handler)]() mutable
+    {
+        std::optional<T> value = try_receive();
+
+        if (value || closed())
+            handler(std::move(value));
+        else    // taken by another receiver
+            async_receive(context, prio, std::move(handler));
+    };
+
+    sync::post_detached(context, prio, std::move(resumeJob));
+}
+
+
+template<class T, channel_mode Mode>
+void channel<T, Mode>::_resume(_Receiver&& receiver)
+{
+    execution_context& context = *receiver.context;
+
+    try
+    {
+        _post_resume(std::move(receiver));
+    }
+    catch (const std::system_error&)
+    {
+        // Not an error of the sender: the handler is dropped and its context reports it
+        context.get_executor().report_exception(std::current_exception());
+    }
+}
+
+
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_CHANNEL_IPP
@@ -0,0 +1,220 @@
+#ifndef SYNC_DETAIL_IMPL_EPOLL_REACTOR_IPP
+#define SYNC_DETAIL_IMPL_EPOLL_REACTOR_IPP
+
+#include "sync/detail/epoll_reactor.hpp"
+
+#ifdef SYNC_HAS_EPOLL
+
+#include <cerrno>
+#include <system_error>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+epoll_reactor::epoll_reactor()
+{
+    _epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+
+    if (_epollFd < 0)
+        throw std::system_error(errno, std::generic_category(), "epoll_create1 failed");
+
+    _eventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (_eventFd < 0)
+    {
+        int error = errno;
+        ::close(_epollFd);
+        throw std::system_error(error, std::generic_category(), "eventfd failed");
+    }
+
+    // Level triggered, stays ready until `poll()` reads it
+    epoll_event event = {};
+    event.events    = EPOLLIN;
+    event.data.fd   = _eventFd;
+
+    if (::epoll_ctl(_epollFd, EPOLL_CTL_ADD, _eventFd, &event) < 0)
+    {
+        int error = errno;
+        ::close(_eventFd);
+        ::close(_epollFd);
+        throw std::system_error(error, std::generic_category(), "epoll_ctl failed");
+    }
+}
+
+
+epoll_reactor::~epoll_reactor()
+{
+    ::close(_eventFd);
+    ::close(_epollFd);
+}
+
+
+void epoll_reactor::watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler)
+{
+    auto watch = std::make_shared<_Watch>(fd, events, prio, std::move(handler));
+
+    std::lock_guard lock(_watchesMtx);
+
+    epoll_event event = {};
+    event.events    = _to_epoll(events) | EPOLLONESHOT;
+    event.data.fd   = fd;
+
+    if (fd == _eventFd || ::epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+        throw std::system_error(fd == _eventFd ? EEXIST : errno, std::generic_category(), "Cannot watch file descriptor");
+
+    _watches.emplace(fd, std::move(watch));
+    ++_watchCount;
+}
+
+
+bool epoll_reactor::unwatch(int fd)
+{
+    std::lock_guard lock(_watchesMtx);
+
+    auto it = _watches.find(fd);
+
+    if (it == _watches.end())
+        return false;
+
+    // The descriptor may be closed already, removed from the epoll set in that case
+    (void)::epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+    it->second->active = false;
+    _watches.erase(it);
+    --_watchCount;
+
+    return true;
+}
+
+
+size_t epoll_reactor::watch_count() const noexcept
+{
+    return _watchCount;
+}
+
+
+size_t epoll_reactor::poll(int timeoutMs, std::vector<priority_job>& jobs)
+{
+    epoll_event events[_max_events];
+
+    int count = ::epoll_wait(_epollFd, events, _max_events, timeoutMs);
+
+    if (count <= 0)
+        return 0;   // timeout or EINTR
+
+    size_t added = 0;
+    std::lock_guard lock(_watchesMtx);
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (events[i].data.fd == _eventFd)
+        {
+            uint64_t value;
+            (void)::read(_eventFd, &value, sizeof(value));
+            continue;
+        }
+
+        auto it = _watches.find(events[i].data.fd);
+
+        if (it == _watches.end())
+            continue;   // removed after the event was queued
+
+        std::shared_ptr<_Watch> watch   = it->second;
+        priority prio                   = watch->prio;
+        io_event ready                  = _from_epoll(events[i].events);
+
+        jobs.emplace_back(prio,
+                            [this, watch = std::move(watch), ready]()
+                            {
+                                if (!watch->active)
+                                    return;
+
+                                try
+                                {
+                                    watch->handler(ready);
+                                }
+                                catch (...)
+                                {
+                                    _rearm(watch);
+                                    throw;
+                                }
+
+                                _rearm(watch);
+                            });
+        ++added;
+    }
+
+    return added;
+}
+
+
+void epoll_reactor::interrupt() noexcept
+{
+    uint64_t value = 1;
+    (void)::write(_eventFd, &value, sizeof(value));
+}
+
+
+void epoll_reactor::_rearm(const std::shared_ptr<_Watch>& watch) noexcept
+{
+    std::lock_guard lock(_watchesMtx);
+
+    auto it = _watches.find(watch->fd);
+
+    if (it == _watches.end() || it->second != watch)
+        return;     // unwatched (the descriptor may belong to a new watch now)
+
+    epoll_event event = {};
+    event.events    = _to_epoll(watch->events) | EPOLLONESHOT;
+    event.data.fd   = watch->fd;
+
+    (void)::epoll_ctl(_epollFd, EPOLL_CTL_MOD, watch->fd, &event);
+}
+
+
+uint32_t epoll_reactor::_to_epoll(io_event events) noexcept
+{
+    uint32_t flags = 0;
+
+    if (has_event(events, io_event::readable))
+        flags |= EPOLLIN;
+
+    if (has_event(events, io_event::writable))
+        flags |= EPOLLOUT;
+
+    return flags;
+}
+
+
+io_event epoll_reactor::_from_epoll(uint32_t events) noexcept
+{
+    io_event flags = io_event::none;
+
+    if (events & EPOLLIN)
+        flags = flags | io_event::readable;
+
+    if (events & EPOLLOUT)
+        flags = flags | io_event::writable;
+
+    if (events & EPOLLERR)
+        flags = flags | io_event::error;
+
+    if (events & EPOLLHUP)
+        flags = flags | io_event::hangup;
+
+    return flags;
+}
+
+
+DETAIL_END
+SYNC_END
+
+#endif  // SYNC_HAS_EPOLL
+
+#endif  // SYNC_DETAIL_IMPL_EPOLL_REACTOR_IPP
@@ -4,22 +4,64 @@
 #include "sync/execution_context.hpp"
 
 SYNC_BEGIN
+DETAIL_BEGIN
 
 template<class Functor, class... Args>
-std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, Functor&& func, Args&&... args)
+job_function make_task_job(basic_executor& executor, Functor&& func, Args&&... args)
+{
+    using _TaskType = binder<Functor, Args...>;
+
+    // Task and promise shared state come from the executor memory
+    std::pmr::memory_resource* resource = executor.get_memory_resource();
+
+    return job_function(std::allocator_arg, resource, std::in_place_type<_TaskType>,
+                        std::allocator_arg, std::pmr::polymorphic_allocator<std::byte>(resource),
+                        std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+job_function make_detached_job(basic_executor& executor, Functor&& func, Args&&... args)
+{
+    using _TaskType = detached_binder<Functor, Args...>;
+
+    if (executor.stopped())
+        throw std::system_error(std::make_error_code(std::errc::operation_not_permitted), "Context executor is stopped");
+
+    return job_function(std::allocator_arg, executor.get_memory_resource(), std::in_place_type<_TaskType>,
+                        std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post_task(execution_context& context, priority prio, priority_job::clock_type::time_point deadline, size_t affinityKey, Functor&& func, Args&&... args)
 {
     basic_executor& executor = context.get_executor();
 
     if (executor.stopped())
         throw std::system_error(std::make_error_code(std::errc::operation_not_permitted), "Context executor is stopped");
 
-    auto taskPtr = std::make_shared<detail::binder<Functor, Args...>>
-                        (std::forward<Functor>(func), std::forward<Args>(args)...);
+    job_function job = make_task_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...);
+
+    // Get the future before submit, the job may run immediately
+    auto result = job.target<binder<Functor, Args...>>()->get_future();
+
+    priority_job scheduled(prio, deadline, std::move(job));
+    scheduled.set_affinity(affinityKey);
 
-    executor.post(detail::priority_job(prio, [taskPtr](void) { return (*taskPtr)(); }));
+    executor.post(std::move(scheduled));
 
     // Return the future of the job's result
-    return taskPtr->get_future();
+    return result;
+}
+
+DETAIL_END
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, Functor&& func, Args&&... args)
+{
+    return detail::post_task(context, prio, detail::priority_job::no_deadline, detail::priority_job::no_affinity, std::forward<Functor>(func), std::forward<Args>(args)...);
 }
 
 
@@ -29,6 +71,136 @@ std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& cont
     return post(context, priority::medium, std::forward<Functor>(func), std::forward<Args>(args)...);
 }
 
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, std::chrono::steady_clock::time_point deadline, Functor&& func, Args&&... args)
+{
+    return detail::post_task(context, prio, deadline, detail::priority_job::no_affinity, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, std::chrono::steady_clock::time_point deadline, Functor&& func, Args&&... args)
+{
+    return detail::post_task(context, priority::medium, deadline, detail::priority_job::no_affinity, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, affinity key, Functor&& func, Args&&... args)
+{
+    return detail::post_task(context, prio, detail::priority_job::no_deadline, key.key, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, affinity key, Functor&& func, Args&&... args)
+{
+    return post(context, priority::medium, key, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::optional<std::future<std::invoke_result_t<Functor, Args...>>> try_post(execution_context& context, priority prio, Functor&& func, Args&&... args)
+{
+    basic_executor& executor = context.get_executor();
+
+    if (executor.stopped())
+        return std::nullopt;
+
+    detail::job_function job = detail::make_task_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...);
+
+    // Get the future before submit, the job may run immediately
+    auto result = job.target<detail::binder<Functor, Args...>>()->get_future();
+
+    if (!executor.try_post(detail::priority_job(prio, std::move(job))))
+        return std::nullopt;
+
+    return result;
+}
+
+
+template<class Functor, class... Args>
+std::optional<std::future<std::invoke_result_t<Functor, Args...>>> try_post(execution_context& context, Functor&& func, Args&&... args)
+{
+    return try_post(context, priority::medium, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> dispatch(execution_context& context, priority prio, Functor&& func, Args&&... args)
+{
+    basic_executor& executor = context.get_executor();
+
+    if (executor.stopped())
+        throw std::system_error(std::make_error_code(std::errc::operation_not_permitted), "Context executor is stopped");
+
+    detail::job_function job = detail::make_task_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...);
+
+    // Get the future before submit, the job may run immediately
+    auto result = job.target<detail::binder<Functor, Args...>>()->get_future();
+
+    executor.dispatch(detail::priority_job(prio, std::move(job)));
+
+    return result;
+}
+
+
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> dispatch(execution_context& context, Functor&& func, Args&&... args)
+{
+    return dispatch(context, priority::medium, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+void post_detached(execution_context& context, priority prio, Functor&& func, Args&&... args)
+{
+    basic_executor& executor = context.get_executor();
+    executor.post(detail::priority_job(prio, detail::make_detached_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...)));
+}
+
+
+template<class Functor, class... Args>
+void post_detached(execution_context& context, Functor&& func, Args&&... args)
+{
+    post_detached(context, priority::medium, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+void post_detached(execution_context& context, priority prio, affinity key, Functor&& func, Args&&... args)
+{
+    basic_executor& executor = context.get_executor();
+
+    detail::priority_job job(prio, detail::make_detached_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...));
+    job.set_affinity(key.key);
+
+    executor.post(std::move(job));
+}
+
+
+template<class Functor, class... Args>
+void post_detached(execution_context& context, affinity key, Functor&& func, Args&&... args)
+{
+    post_detached(context, priority::medium, key, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+
+template<class Functor, class... Args>
+void defer(execution_context& context, priority prio, Functor&& func, Args&&... args)
+{
+    basic_executor& executor = context.get_executor();
+    executor.defer(detail::priority_job(prio, detail::make_detached_job(executor, std::forward<Functor>(func), std::forward<Args>(args)...)));
+}
+
+
+template<class Functor, class... Args>
+void defer(execution_context& context, Functor&& func, Args&&... args)
+{
+    defer(context, priority::medium, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
 SYNC_END
 
 
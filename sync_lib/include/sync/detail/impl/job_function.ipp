@@ -0,0 +1,84 @@
+#ifndef SYNC_DETAIL_IMPL_JOB_FUNCTION_IPP
+#define SYNC_DETAIL_IMPL_JOB_FUNCTION_IPP
+
+#include "sync/detail/job_function.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+job_function::~job_function()
+{
+    _reset();
+}
+
+
+job_function::job_function(job_function&& other) noexcept
+{
+    _move(std::move(other));
+}
+
+
+job_function& job_function::operator=(job_function&& other) noexcept
+{
+    if (this != &other)
+    {
+        _reset();
+        _move(std::move(other));
+    }
+
+    return *this;
+}
+
+
+void job_function::operator()(void) const
+{
+    if (_ops == nullptr)
+        throw std::bad_function_call();
+
+    _ops->invoke(_target);
+}
+
+
+job_function::operator bool() const noexcept
+{
+    return _ops != nullptr;
+}
+
+
+void job_function::_reset() noexcept
+{
+    if (_ops != nullptr)
+        _ops->destroy(_target, _resource);
+
+    _ops    = nullptr;
+    _target = nullptr;
+}
+
+
+void job_function::_move(job_function&& other) noexcept
+{
+    _ops        = other._ops;
+    _resource   = other._resource;
+
+    if (_ops == nullptr)
+        _target = nullptr;
+    else if (_ops->relocate != nullptr)
+    {
+        _ops->relocate(_buffer, other._target);
+        _target = _buffer;
+    }
+    else
+        _target = other._target;   // stored in memory resource, steal the pointer
+
+    other._ops      = nullptr;
+    other._target   = nullptr;
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_JOB_FUNCTION_IPP
@@ -0,0 +1,167 @@
+#ifndef SYNC_DETAIL_IMPL_MPMC_RING_IPP
+#define SYNC_DETAIL_IMPL_MPMC_RING_IPP
+
+#include <bit>
+#include <cstdint>
+#include <new>
+
+#include "sync/detail/mpmc_ring.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+template<class T>
+mpmc_ring<T>::mpmc_ring(size_t capacity)
+    :   _cells(new _Cell[std::bit_ceil(capacity < 2 ? size_t(2) : capacity)]),
+        _mask(std::bit_ceil(capacity < 2 ? size_t(2) : capacity) - 1)
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+
+template<class T>
+mpmc_ring<T>::~mpmc_ring()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (size_t pos = _dequeuePos; pos != _enqueuePos; ++pos)
+            _value_of(_cells[pos & _mask])->~T();
+    }
+}
+
+
+template<class T>
+bool mpmc_ring<T>::try_push(T&& value) noexcept
+{
+    _Cell* cell;
+    size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &_cells[pos & _mask];
+
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            // Slot free for this round, claim it
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false;   // slot still holds the value of the previous round
+        else
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+    }
+
+    ::new (static_cast<void*>(cell->storage)) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+
+template<class T>
+bool mpmc_ring<T>::try_pop(T& value) noexcept
+{
+    _Cell* cell;
+    size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &_cells[pos & _mask];
+
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            // Slot written for this round, claim it
+            if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false;   // not written yet
+        else
+            pos = _dequeuePos.load(std::memory_order_relaxed);
+    }
+
+    T* stored = _value_of(*cell);
+
+    value = std::move(*stored);
+    stored->~T();
+
+    // Free the slot for the next round
+    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+
+    return true;
+}
+
+
+template<class T>
+template<class InputIt>
+size_t mpmc_ring<T>::try_push_batch(InputIt first, size_t count) noexcept
+{
+    size_t pushed = 0;
+
+    while (pushed < count && try_push(std::move(*first)))
+    {
+        ++first;
+        ++pushed;
+    }
+
+    return pushed;
+}
+
+
+template<class T>
+template<class OutputIt>
+size_t mpmc_ring<T>::try_pop_batch(OutputIt out, size_t maxCount)
+{
+    size_t popped = 0;
+    T value;
+
+    while (popped < maxCount && try_pop(value))
+    {
+        *out = std::move(value);
+        ++out;
+        ++popped;
+    }
+
+    return popped;
+}
+
+
+template<class T>
+size_t mpmc_ring<T>::capacity() const noexcept
+{
+    return _mask + 1;
+}
+
+
+template<class T>
+size_t mpmc_ring<T>::size_approx() const noexcept
+{
+    size_t dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+    size_t enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+
+    return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+}
+
+
+template<class T>
+T* mpmc_ring<T>::_value_of(_Cell& cell) noexcept
+{
+    return std::launder(reinterpret_cast<T*>(cell.storage));
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_MPMC_RING_IPP
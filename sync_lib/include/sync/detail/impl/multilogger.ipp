@@ -1,19 +1,13 @@
 #ifndef SYNC_DETAIL_IMPL_MULTILOGGER_IPP
 #define SYNC_DETAIL_IMPL_MULTILOGGER_IPP
 
+#include <system_error>
+
 #include "sync/multilogger.hpp"
 
 SYNC_BEGIN
 
 
-template<class StreamType>
-void multilogger::add(StreamType& ostream)
-{
-    std::lock_guard lock(_mtx);
-    _ostreams.push_back(detail::output_stream(ostream));
-}
-
-
 void multilogger::clear()
 {
     std::lock_guard lock(_mtx);
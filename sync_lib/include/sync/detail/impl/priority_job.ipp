@@ -29,21 +29,49 @@ void priority_job::operator()(void) const
 }
 
 
-uint8_t priority_job::effective_priority() const
+priority priority_job::get_priority() const
 {
-    // Subtract from original priority the number of seconds this object waited since timestamp
-    auto age    = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - _timestamp).count();
-    auto prio   = static_cast<uint8_t>(_prio);
+    return _prio;
+}
+
+
+priority_job::clock_type::time_point priority_job::get_deadline() const
+{
+    return _deadline;
+}
+
+
+size_t priority_job::get_affinity() const
+{
+    return _affinity;
+}
+
 
-    return (prio <= age) ? 0 : prio - age;
+void priority_job::set_affinity(size_t key)
+{
+    _affinity = key;
+}
+
+
+priority_job::clock_type::time_point priority_job::get_timestamp() const
+{
+    return _timestamp;
+}
+
+
+void priority_job::stamp(clock_type::time_point now)
+{
+    _timestamp = now;
 }
 
 
 void priority_job::_move(priority_job&& other) noexcept
 {
     _prio       = other._prio;
+    _affinity   = other._affinity;
     _job        = std::move(other._job);
-    _timestamp  = std::chrono::steady_clock::now(); // timestamp is refreshed
+    _timestamp  = other._timestamp;   // keep insertion time, containers move jobs around
+    _deadline   = other._deadline;
 }
 
 
@@ -0,0 +1,545 @@
+#ifndef SYNC_DETAIL_IMPL_RING_SCHEDULER_IPP
+#define SYNC_DETAIL_IMPL_RING_SCHEDULER_IPP
+
+#include <stdexcept>
+
+#include "sync/detail/ring_scheduler.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+template<bool PerPriority>
+scheduler<basic_ring_policy<PerPriority>>::scheduler(const queue_options& options)
+    : _options(options)
+{
+    // Reserved jobs would run like any other, silently breaking the guarantee
+    if (_options.reserved_workers > 0)
+        throw std::invalid_argument("Worker reservation needs the generic scheduler");
+
+    if (_options.task_resource != nullptr)
+        _taskResource = _options.task_resource;
+
+    for (size_t ring = 0; ring < _rings.size(); ++ring)
+    {
+        size_t capacity = _options.capacity;
+
+        if constexpr (PerPriority)
+            capacity = std::min(capacity, _options.priority_capacity[ring]);
+
+        if (capacity == queue_options::unbounded)
+            capacity = basic_ring_policy<PerPriority>::default_capacity;
+
+        // Rounded up to a power of 2, the counters keep the exact limits
+        _rings[ring] = std::make_unique<_Ring>(capacity);
+    }
+}
+
+
+template<bool PerPriority>
+scheduler<basic_ring_policy<PerPriority>>::~scheduler()
+{
+    stop();
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::post(detail::priority_job&& job)
+{
+    if (_try_push(job))
+    {
+        _wake_parked();
+        return;
+    }
+
+    switch (_options.overflow)
+    {
+        case overflow_policy::block:
+        {
+            if (!_push_blocking(job))
+            {
+                ++_rejectedPosts;
+                throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "Context executor queue is full");
+            }
+
+            _wake_parked();
+            break;
+        }
+        case overflow_policy::caller_runs:
+        {
+            // Do the job on the calling thread, unless already too late
+            if (_meets_deadline(job))
+                _execute(job);
+
+            break;
+        }
+        case overflow_policy::reject:
+        default:
+        {
+            ++_rejectedPosts;
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "Context executor queue is full");
+        }
+    }
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::try_post(detail::priority_job&& job)
+{
+    if (_stop)
+        return false;
+
+    if (!_try_push(job))
+    {
+        ++_rejectedPosts;
+        return false;
+    }
+
+    _wake_parked();
+    return true;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::defer(detail::priority_job&& job)
+{
+    if (detail::call_stack::frame* frame = detail::call_stack::find(this))
+        frame->defer(std::move(job));
+    else
+        post(std::move(job));
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::dispatch(detail::priority_job&& job)
+{
+    detail::call_stack::frame* frame = detail::call_stack::find(this);
+
+    if (frame == nullptr || !frame->enter_dispatch())
+    {
+        post(std::move(job));
+        return;
+    }
+
+    if (_meets_deadline(job))
+        _execute(job);
+
+    frame->leave_dispatch();
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::stopped() const
+{
+    return _stop;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::running_in_this_thread() const
+{
+    return detail::call_stack::find(this) != nullptr;
+}
+
+
+template<bool PerPriority>
+std::pmr::memory_resource* scheduler<basic_ring_policy<PerPriority>>::get_memory_resource() const
+{
+    return _taskResource;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::report_exception(std::exception_ptr error)
+{
+    if (_options.exception_handler)
+        _options.exception_handler(error);
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::jobs_done() const
+{
+    return _jobsDone;
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::rejected_posts() const
+{
+    return _rejectedPosts;
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::blocked_posts() const
+{
+    return _blockedPosts;
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::stolen_jobs() const
+{
+    return 0;
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::deadline_misses() const
+{
+    size_t total = 0;
+
+    for (const auto& misses : _deadlineMisses)
+        total += misses;
+
+    return total;
+}
+
+
+template<bool PerPriority>
+size_t scheduler<basic_ring_policy<PerPriority>>::deadline_misses(priority prio) const
+{
+    return _deadlineMisses[detail::priority_band(prio)];
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::stop()
+{
+    // Flags change under the park mutex, a thread about to park sees them or gets the notification
+    std::lock_guard lock(_parkMtx);
+    _stop = true;
+    _parkCV.notify_all();
+    _freeSpaceCV.notify_all();
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::restart()
+{
+    std::lock_guard lock(_parkMtx);
+    _stop = false;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::allowed_to_wait() const
+{
+    return _wait;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::allow_wait()
+{
+    std::lock_guard lock(_parkMtx);
+    _wait = true;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::forbid_wait()
+{
+    std::lock_guard lock(_parkMtx);
+    _wait = false;
+    _parkCV.notify_all();
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::run(size_t worker)
+{
+    (void)worker;
+
+    // Mark this thread as running the scheduler
+    detail::call_stack::frame frame(this);
+
+    detail::priority_job job;
+    std::vector<detail::priority_job> continuations;
+    size_t idleRounds = 0;
+
+    for (;;)
+    {
+        // Stopped without waiting: pending jobs stay queued
+        if (_stop && !_wait)
+            return;
+
+        if (_try_pop(job))
+        {
+            idleRounds = 0;
+            _wake_blocked_producers();
+
+            // Drop the job if its result is no longer useful
+            if (!_meets_deadline(job))
+                continue;
+
+            _execute(job);
+
+            // Continuations deferred by the job run here, no queueing and no wake-up
+            while (frame.has_deferred())
+            {
+                frame.take_deferred(continuations);
+
+                for (auto& continuation : continuations)
+                    _execute(continuation);
+            }
+
+            continue;
+        }
+
+        // A slot claimed by a producer but not written yet still counts as pending
+        if (_has_jobs())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (_stop || !_wait)
+            return;
+
+        // Empty: retry a few times before parking, a post often follows shortly
+        if (++idleRounds < _spin_count)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleRounds = 0;
+        _park();
+    }
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::set_worker_count(size_t count)
+{
+    (void)count;
+}
+
+
+#ifdef SYNC_HAS_EPOLL
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler)
+{
+    (void)fd;
+    (void)events;
+    (void)prio;
+    (void)handler;
+
+    throw std::system_error(std::make_error_code(std::errc::operation_not_supported), "Descriptor watches need a mutex based policy");
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::unwatch(int fd)
+{
+    (void)fd;
+    return false;
+}
+#endif  // SYNC_HAS_EPOLL
+
+
+template<bool PerPriority>
+typename scheduler<basic_ring_policy<PerPriority>>::_Ring& scheduler<basic_ring_policy<PerPriority>>::_ring_for(priority prio)
+{
+    if constexpr (PerPriority)
+        return *_rings[detail::priority_band(prio)];
+    else
+        return *_rings[0];
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_try_push(detail::priority_job& job)
+{
+    size_t band = detail::priority_band(job.get_priority());
+
+    if (!_count_job(band))
+        return false;
+
+    if (_ring_for(job.get_priority()).try_push(std::move(job)))
+        return true;
+
+    _uncount_job(band);
+    return false;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_try_pop(detail::priority_job& job)
+{
+    for (auto& ring : _rings)
+    {
+        if (ring->try_pop(job))
+        {
+            _uncount_job(detail::priority_band(job.get_priority()));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_count_job(size_t band)
+{
+    // Take a unit, give it back if over the limit: a concurrent post may be refused while it is held
+    auto take = [](std::atomic_size_t& counter, size_t limit)
+    {
+        if (limit == queue_options::unbounded || counter.fetch_add(1, std::memory_order_relaxed) < limit)
+            return true;
+
+        counter.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    };
+
+    if (!take(_pendingJobs, _options.capacity))
+        return false;
+
+    if (take(_pendingJobsPerBand[band], _options.priority_capacity[band]))
+        return true;
+
+    if (_options.capacity != queue_options::unbounded)
+        _pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+
+    return false;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::_uncount_job(size_t band)
+{
+    if (_options.capacity != queue_options::unbounded)
+        _pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+
+    if (_options.priority_capacity[band] != queue_options::unbounded)
+        _pendingJobsPerBand[band].fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_has_jobs() const
+{
+    for (const auto& ring : _rings)
+        if (ring->size_approx() > 0)
+            return true;
+
+    return false;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::_wake_parked()
+{
+    // Pairs with the fence in `_park()`: either the parked thread is counted here or it sees the job there
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_parkedThreads.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard lock(_parkMtx);
+        _parkCV.notify_one();
+    }
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::_wake_blocked_producers()
+{
+    // Pairs with the fence in `_push_blocking()`
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_blockedProducers.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard lock(_parkMtx);
+        _freeSpaceCV.notify_all();
+    }
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::_park()
+{
+    std::unique_lock lock(_parkMtx);
+
+    ++_parkedThreads;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    while (!_has_jobs() && !_stop && _wait)
+        _parkCV.wait(lock);
+
+    --_parkedThreads;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_push_blocking(detail::priority_job& job)
+{
+    bool accepted = false;
+    auto canContinue = [this, &job, &accepted]() { return _stop || (accepted = _try_push(job)); };
+
+    ++_blockedPosts;
+
+    std::unique_lock lock(_parkMtx);
+
+    ++_blockedProducers;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_options.block_timeout == std::chrono::milliseconds::max())
+        _freeSpaceCV.wait(lock, canContinue);
+    else
+        _freeSpaceCV.wait_for(lock, _options.block_timeout, canContinue);
+
+    --_blockedProducers;
+
+    if (accepted)
+        return true;
+
+    if (_stop)
+        throw std::system_error(std::make_error_code(std::errc::operation_not_permitted), "Context executor is stopped");
+
+    return false;
+}
+
+
+template<bool PerPriority>
+void scheduler<basic_ring_policy<PerPriority>>::_execute(const detail::priority_job& job)
+{
+    try
+    {
+        job();
+    }
+    catch (...)
+    {
+        report_exception(std::current_exception());
+    }
+
+    // Count work done (even if throws)
+    ++_jobsDone;
+}
+
+
+template<bool PerPriority>
+bool scheduler<basic_ring_policy<PerPriority>>::_meets_deadline(const detail::priority_job& job)
+{
+    // Jobs without deadline don't read the clock
+    if (job.get_deadline() == detail::priority_job::no_deadline ||
+        job.get_deadline() >= detail::priority_job::clock_type::now())
+        return true;
+
+    ++_deadlineMisses[detail::priority_band(job.get_priority())];
+
+    if (_options.deadline_miss_handler)
+        _options.deadline_miss_handler(job.get_priority());
+
+    return false;
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_RING_SCHEDULER_IPP
@@ -8,98 +8,991 @@ SYNC_BEGIN
 DETAIL_BEGIN
 
 
-scheduler::~scheduler()
+template<class Policy>
+scheduler<Policy>::scheduler(const queue_options& options)
+    : _options(options)
+{
+    if (_options.task_resource != nullptr)
+        _taskResource = _options.task_resource;
+}
+
+
+template<class Policy>
+scheduler<Policy>::~scheduler()
 {
     stop();
 }
 
 
-void scheduler::post(detail::priority_job&& job)
+template<class Policy>
+void scheduler<Policy>::post(detail::priority_job&& job)
+{
+    std::unique_lock<std::mutex> lock(_pendingJobsMtx);
+
+    if (!_has_space_for(job))
+    {
+        switch (_options.overflow)
+        {
+            case overflow_policy::block:
+            {
+                auto canContinue = [this, &job]() { return _stop || _has_space_for(job); };
+
+                ++_blockedPosts;
+                ++_blockedProducers;
+
+                bool hasSpace = true;
+                if (_options.block_timeout == std::chrono::milliseconds::max())
+                    _freeSpaceCV.wait(lock, canContinue);
+                else
+                    hasSpace = _freeSpaceCV.wait_for(lock, _options.block_timeout, canContinue);
+
+                --_blockedProducers;
+
+                if (_stop)
+                    throw std::system_error(std::make_error_code(std::errc::operation_not_permitted), "Context executor is stopped");
+
+                if (!hasSpace)
+                {
+                    ++_rejectedPosts;
+                    throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "Context executor queue is full");
+                }
+
+                break;
+            }
+            case overflow_policy::caller_runs:
+            {
+                lock.unlock();
+
+                // Do the job on the calling thread, unless already too late
+                if (_meets_deadline(job))
+                    _execute(job);
+
+                return;
+            }
+            case overflow_policy::reject:
+            default:
+            {
+                ++_rejectedPosts;
+                throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "Context executor queue is full");
+            }
+        }
+    }
+
+    _push(std::move(job));
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::try_post(detail::priority_job&& job)
 {
     std::lock_guard lock(_pendingJobsMtx);
-    _pendingJobs.emplace(std::move(job));
-    _pendingJobsCV.notify_one();
+
+    if (_stop)
+        return false;
+
+    if (!_has_space_for(job))
+    {
+        ++_rejectedPosts;
+        return false;
+    }
+
+    _push(std::move(job));
+    return true;
+}
+
+
+template<class Policy>
+void scheduler<Policy>::defer(detail::priority_job&& job)
+{
+    if (detail::call_stack::frame* frame = detail::call_stack::find(this))
+        frame->defer(std::move(job));
+    else
+        post(std::move(job));
+}
+
+
+template<class Policy>
+void scheduler<Policy>::dispatch(detail::priority_job&& job)
+{
+    detail::call_stack::frame* frame = detail::call_stack::find(this);
+
+    if (frame == nullptr || !frame->enter_dispatch())
+    {
+        post(std::move(job));
+        return;
+    }
+
+    if (_meets_deadline(job))
+        _execute(job);
+
+    frame->leave_dispatch();
 }
 
 
-size_t scheduler::jobs_done() const
+template<class Policy>
+size_t scheduler<Policy>::jobs_done() const
 {
     return _jobsDone;
 }
 
 
-bool scheduler::stopped() const
+template<class Policy>
+size_t scheduler<Policy>::rejected_posts() const
+{
+    return _rejectedPosts;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::blocked_posts() const
+{
+    return _blockedPosts;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::stolen_jobs() const
+{
+    return _stolenJobs;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::deadline_misses() const
+{
+    size_t total = 0;
+
+    for (const auto& misses : _deadlineMisses)
+        total += misses;
+
+    return total;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::deadline_misses(priority prio) const
+{
+    return _deadlineMisses[detail::priority_band(prio)];
+}
+
+
+template<class Policy>
+std::pmr::memory_resource* scheduler<Policy>::get_memory_resource() const
+{
+    return _taskResource;
+}
+
+
+template<class Policy>
+void scheduler<Policy>::report_exception(std::exception_ptr error)
+{
+    if (_options.exception_handler)
+        _options.exception_handler(error);
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::running_in_this_thread() const
+{
+    return detail::call_stack::find(this) != nullptr;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::stopped() const
 {
     std::lock_guard lock(_pendingJobsMtx);
     return _stop;
 }
 
 
-void scheduler::stop()
+template<class Policy>
+void scheduler<Policy>::stop()
 {
     std::lock_guard lock(_pendingJobsMtx);
     _stop = true;
-    _pendingJobsCV.notify_all();
+    _update_discard_pending();
+    _wake_all();
+    _freeSpaceCV.notify_all();
+    _interrupt_reactor();
 }
 
 
-void scheduler::restart()
+template<class Policy>
+void scheduler<Policy>::restart()
 {
     std::lock_guard lock(_pendingJobsMtx);
     _stop = false;
+    _update_discard_pending();
 }
 
 
-bool scheduler::allowed_to_wait() const
+template<class Policy>
+bool scheduler<Policy>::allowed_to_wait() const
 {
     std::lock_guard lock(_pendingJobsMtx);
     return _wait;
 }
 
 
-void scheduler::allow_wait()
+template<class Policy>
+void scheduler<Policy>::allow_wait()
 {
     std::lock_guard lock(_pendingJobsMtx);
     _wait = true;
+    _update_discard_pending();
 }
 
 
-void scheduler::forbid_wait()
+template<class Policy>
+void scheduler<Policy>::forbid_wait()
 {
     std::lock_guard lock(_pendingJobsMtx);
     _wait = false;
-    _pendingJobsCV.notify_all();
+    _update_discard_pending();
+    _wake_all();
 }
 
 
-void scheduler::run()
+template<class Policy>
+void scheduler<Policy>::run(size_t worker)
 {
-    detail::priority_job job;
+    _SYNC_ASSERT(worker == no_worker || worker < _workers.size(), "Worker index out of range!");
+
+    // Mark this thread as running the scheduler
+    detail::call_stack::frame frame(this);
+    _RunningThread runningThread(_runningThreads);
+
+    _Batch batch;
+    std::vector<detail::priority_job> continuations;
+    _Slot slot = _Slot::none;
+
+    batch.jobs.reserve(_max_batch_size);
+
+    {   // Idle threads steal from the batch while this thread runs a job
+        std::lock_guard lock(_pendingJobsMtx);
+        _batches.push_back(&batch);
+
+        // Jobs posted from this thread to its own queue are watched (see `_Stall`)
+        if (worker != no_worker)
+            _workers[worker].thread = std::this_thread::get_id();
+    }
 
     for (;;)
     {
         {   // Empty scope start -> mutex lock and job decision
             std::unique_lock<std::mutex> lock(_pendingJobsMtx);
 
-            if (!_stop && _wait && _pendingJobs.empty())
-                _pendingJobsCV.wait(lock);
+            // The previous jobs are done
+            _release_slot(slot);
+            _release_batch(batch);
+
+            if (worker != no_worker)
+                _clear_stall(worker);
+
+#ifdef SYNC_HAS_EPOLL
+            // Keep descriptors serviced while the queue stays busy
+            if (_reactor_has_work() && !_reactorPolling && _jobsSincePoll >= _reactor_poll_interval)
+                _poll_reactor(lock, 0);
+#endif  // SYNC_HAS_EPOLL
+
+            for (;;)
+            {
+                if (_stop && (!_wait || (_empty() && _batchedJobs == 0)))
+                {
+                    // Threads waiting for a slot or for a queue to steal from see the end too
+                    _wake_all();
+                    _leave(batch);
+                    return;
+                }
+
+                if (_has_runnable_job(worker))
+                {
+                    _take_batch(batch, slot, worker);
+                    break;
+                }
+
+                // A busy thread may wait for a job of its own batch
+                if (_steal_batched_job(batch))
+                    break;
+
+                // No jobs, but watched descriptors can still produce some
+                if (_empty() && _reactor_has_work() && !_reactorPolling)
+                {
+                    _poll_reactor(lock, -1);
+                    continue;
+                }
+
+                if (!_wait && _empty() && _batchedJobs == 0 && !_reactor_has_work())
+                {
+                    _leave(batch);
+                    return;
+                }
+
+                // One idle thread checks that the workers with a job posted to themselves still make progress
+                bool watching = _watchedWorkers > 0 && !_stallWatcher;
+
+                if (watching)
+                    _stallWatcher = true;
+
+                // No jobs, only jobs waiting for a worker that is not reserved or only jobs of busy workers
+                bool woken = _wait_for_work(lock, worker, watching);
+
+                if (watching)
+                {
+                    _stallWatcher = false;
+
+                    if (!woken)
+                        _check_stalls();
+                }
+            }
+
+#ifdef SYNC_HAS_EPOLL
+            _jobsSincePoll += batch.jobs.size();
+#endif  // SYNC_HAS_EPOLL
+        }   // Empty scope end -> unlock, can start job
 
-            if (!_wait && (_stop || _pendingJobs.empty()))
-                return;
+        // The first job is claimed, claim the next ones one by one: idle threads may take some meanwhile
+        for (size_t i = 0; i < batch.jobs.size(); i = batch.next.fetch_add(1, std::memory_order_relaxed))
+        {
+            // Stopped without waiting: jobs not started yet go back to the queue
+            if (i > 0 && _discardPending.load(std::memory_order_relaxed))
+            {
+                std::lock_guard lock(_pendingJobsMtx);
+                _give_back(batch, i);
+                break;
+            }
+
+            // Drop the job if its result is no longer useful
+            if (!_meets_deadline(batch.jobs[i]))
+                continue;
+
+            // Do the job without holding any locks
+            _execute(batch.jobs[i]);
+
+            // Continuations deferred by the job run here, no queueing and no wake-up
+            while (frame.has_deferred())
+            {
+                frame.take_deferred(continuations);
+
+                for (auto& continuation : continuations)
+                    _execute(continuation);
+            }
+        }
+    }
+}
 
-            if (_stop && _pendingJobs.empty())
-                return;
 
-            job = std::move(const_cast<detail::priority_job&>(_pendingJobs.top()));
-            _pendingJobs.pop();
-        }   // Empty scope end -> unlock, can start job
+template<class Policy>
+void scheduler<Policy>::set_worker_count(size_t count)
+{
+    std::lock_guard lock(_pendingJobsMtx);
+    _workerCount    = count;
+    _workers        = std::vector<_Worker>(count);
+    _idleWorkers.reserve(count);
+}
+
+
+#ifdef SYNC_HAS_EPOLL
+template<class Policy>
+void scheduler<Policy>::watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler)
+{
+    std::lock_guard lock(_pendingJobsMtx);
+
+    if (!_reactor)
+        _reactor = std::make_unique<epoll_reactor>();
+
+    _reactor->watch(fd, events, prio, std::move(handler));
+
+    // Idle waiting threads can take the reactor now
+    _wake_all();
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::unwatch(int fd)
+{
+    std::lock_guard lock(_pendingJobsMtx);
+
+    if (!_reactor || !_reactor->unwatch(fd))
+        return false;
+
+    // The polling thread checks again if there is still something to wait for
+    _interrupt_reactor();
+    return true;
+}
+#endif  // SYNC_HAS_EPOLL
+
+
+template<class Policy>
+bool scheduler<Policy>::_empty() const
+{
+    return _pendingJobs.empty() && _reservedJobs.empty() && _affineJobCount == 0;
+}
 
-        // Do the job without holding any locks
-        job();
 
-        // Count work done (even if throws)
-        ++_jobsDone;
+template<class Policy>
+bool scheduler<Policy>::_reservation_enabled() const
+{
+    return _workerCount > 1 && _options.reserved_workers > 0;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_has_runnable_job(size_t worker) const
+{
+    if (!_reservedJobs.empty())
+        return true;
+
+    if (!_can_start_other_job())
+        return false;
+
+    if (!_pendingJobs.empty())
+        return true;
+
+    if (_affineJobCount == 0)
+        return false;
+
+    if (worker != no_worker && !_workers[worker].jobs.empty())
+        return true;
+
+    return _find_victim(worker) != no_worker;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_can_start_other_job() const
+{
+    if (!_reservation_enabled())
+        return true;
+
+    // Keep at least one worker for other jobs
+    size_t reserved = std::min(_options.reserved_workers, _workerCount - 1);
+
+    // Reserved workers already busy with reserved jobs don't need to be kept idle
+    size_t keepIdle = reserved > _runningReservedJobs ? reserved - _runningReservedJobs : 0;
+    size_t busy     = _runningReservedJobs + _runningOtherJobs;
+
+    return busy + 1 + keepIdle <= _workerCount;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::_batch_size(size_t worker) const
+{
+    // Reservation accounting takes one slot for each job
+    if (_reservation_enabled())
+        return 1;
+
+    // Leave half of the own queue to the workers that steal
+    if (worker != no_worker && !_workers[worker].jobs.empty())
+        return std::clamp(_workers[worker].jobs.size() / 2, size_t(1), _max_batch_size);
+
+    // Stolen jobs are taken one by one
+    if (_pendingJobs.empty())
+        return 1;
+
+    // Half of a fair share: other threads still find work and a new urgent job waits for few others
+    size_t threads = std::max(_runningThreads.load(std::memory_order_relaxed), size_t(1));
+
+    return std::clamp(_pendingJobs.size() / (2 * threads), size_t(1), _max_batch_size);
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_take_batch(_Batch& batch, _Slot& slot, size_t worker)
+{
+    // Take several jobs for one lock if the queue is deep enough
+    size_t batchSize = _batch_size(worker);
+
+    do
+    {
+        detail::priority_job job = _pop(slot, worker);
+
+        batch.bands[batch.jobs.size()] = detail::priority_band(job.get_priority());
+        batch.jobs.push_back(std::move(job));
+    } while (batch.jobs.size() < batchSize && _has_runnable_job(worker));
+
+    // The first job starts now, the others wait for this thread or for an idle one
+    batch.next.store(1, std::memory_order_relaxed);
+    batch.counted   = batch.jobs.size() - 1;
+    _batchedJobs   += batch.counted;
+
+    if (batch.counted > 0)
+        _wake_one();
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_steal_batched_job(_Batch& batch)
+{
+    if (_batchedJobs == 0)
+        return false;
+
+    for (_Batch* victim : _batches)
+    {
+        if (victim->counted == 0)
+            continue;
+
+        // The owner may have started all of them
+        size_t index = victim->next.fetch_add(1, std::memory_order_relaxed);
+
+        if (index >= victim->jobs.size())
+            continue;
+
+        detail::priority_job& job = victim->jobs[index];
+
+        if (job.get_affinity() != detail::priority_job::no_affinity && !_workers.empty())
+            ++_stolenJobs;
+
+        batch.jobs.push_back(std::move(job));
+        batch.next.store(1, std::memory_order_relaxed);
+
+        --victim->counted;
+        _uncount_batched(1);
+
+        return true;
+    }
+
+    return false;
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_release_batch(_Batch& batch)
+{
+    if (batch.counted > 0)
+    {
+        _uncount_batched(batch.counted);
+        batch.counted = 0;
     }
+
+    batch.jobs.clear();
+    batch.next.store(0, std::memory_order_relaxed);
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_give_back(_Batch& batch, size_t first)
+{
+    // Jobs between `first` and `last` were stolen
+    size_t last = batch.next.exchange(batch.jobs.size(), std::memory_order_relaxed);
+
+    _uncount_batched(batch.counted);
+    batch.counted = 0;
+
+    _push(std::move(batch.jobs[first]));
+
+    for (size_t i = last; i < batch.jobs.size(); ++i)
+        _push(std::move(batch.jobs[i]));
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_uncount_batched(size_t count)
+{
+    _batchedJobs -= count;
+
+    if (_blockedProducers > 0)
+        _freeSpaceCV.notify_all();
+
+    // Threads about to leave `run()` wait for the last batch
+    if (_batchedJobs == 0 && (_stop || !_wait))
+        _wake_all();
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_leave(_Batch& batch)
+{
+    _release_batch(batch);
+    _batches.erase(std::find(_batches.begin(), _batches.end(), &batch));
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_update_discard_pending()
+{
+    _discardPending.store(_stop && !_wait, std::memory_order_relaxed);
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_release_slot(_Slot& slot)
+{
+    switch (slot)
+    {
+        case _Slot::reserved:
+            --_runningReservedJobs;
+            break;
+        case _Slot::other:
+        {
+            --_runningOtherJobs;
+
+            // A worker may wait for this slot
+            if (!_pendingJobs.empty() || _affineJobCount > 0)
+                _wake_one();
+
+            break;
+        }
+        case _Slot::none:
+        default:
+            break;
+    }
+
+    slot = _Slot::none;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_has_space_for(const detail::priority_job& job) const
+{
+    size_t band     = detail::priority_band(job.get_priority());
+    size_t queued   = _pendingJobs.size() + _reservedJobs.size() + _affineJobCount;
+    size_t inBand   = _pendingJobsPerBand[band];
+
+    // `_batchedJobs` bounds the batched jobs not started yet, count them one by one only near the limits
+    if (queued + _batchedJobs < _options.capacity && inBand + _batchedJobs < _options.priority_capacity[band])
+        return true;
+
+    for (const _Batch* batch : _batches)
+    {
+        for (size_t i = std::min(batch->next.load(std::memory_order_relaxed), batch->jobs.size()); i < batch->jobs.size(); ++i)
+        {
+            ++queued;
+
+            if (batch->bands[i] == band)
+                ++inBand;
+        }
+    }
+
+    return queued < _options.capacity && inBand < _options.priority_capacity[band];
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_push(detail::priority_job&& job)
+{
+    ++_pendingJobsPerBand[detail::priority_band(job.get_priority())];
+
+    if (_reservation_enabled() && job.get_priority() <= _options.reserved_priority)
+    {
+        _reservedJobs.push(std::move(job));
+        _wake_one();
+    }
+    else if (job.get_affinity() != detail::priority_job::no_affinity && !_workers.empty())
+    {
+        size_t worker   = _worker_of(job.get_affinity());
+        _Worker& owner  = _workers[worker];
+
+        owner.jobs.push(std::move(job));
+        ++_affineJobCount;
+
+        // The owner takes it when done with its current job, unless the queue grows enough to steal
+        if (owner.idle)
+            _wake_worker(worker);
+        else if (owner.jobs.size() >= std::max(_options.affinity_steal_threshold, size_t(1)))
+            _wake_one();
+        else if (owner.stall == _Stall::none && owner.thread == std::this_thread::get_id())
+        {
+            // Posted by the running job, which may wait for it: others steal if the owner stops making progress
+            owner.stall = _Stall::posted;
+            ++_watchedWorkers;
+
+            if (!_stallWatcher)
+                _wake_one();
+        }
+    }
+    else
+    {
+        _pendingJobs.push(std::move(job));
+        _wake_one();
+    }
+
+    _interrupt_reactor();
+}
+
+
+template<class Policy>
+detail::priority_job scheduler<Policy>::_pop(_Slot& slot, size_t worker)
+{
+    detail::priority_job job;
+    _Slot taken = _Slot::other;
+
+    if (!_reservedJobs.empty())
+    {
+        job     = _reservedJobs.pop();
+        taken   = _Slot::reserved;
+    }
+    else if (worker != no_worker && !_workers[worker].jobs.empty())
+    {
+        job = _workers[worker].jobs.pop();
+        --_affineJobCount;
+    }
+    else if (!_pendingJobs.empty())
+    {
+        job = _pendingJobs.pop();
+    }
+    else
+    {
+        // `_has_runnable_job()` found a worker that falls behind
+        job = _workers[_find_victim(worker)].jobs.pop();
+        --_affineJobCount;
+        ++_stolenJobs;
+    }
+
+    if (_reservation_enabled())
+    {
+        if (taken == _Slot::reserved)
+            ++_runningReservedJobs;
+        else
+            ++_runningOtherJobs;
+
+        slot = taken;
+    }
+
+    --_pendingJobsPerBand[detail::priority_band(job.get_priority())];
+
+    if (_blockedProducers > 0)
+        _freeSpaceCV.notify_all();
+
+    return job;
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::_worker_of(size_t key) const
+{
+    // Fibonacci hashing, keys that differ only in a few bits still spread over the workers
+    uint64_t mixed = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+
+    return static_cast<size_t>((mixed >> 32) % _workers.size());
+}
+
+
+template<class Policy>
+size_t scheduler<Policy>::_find_victim(size_t worker) const
+{
+    if (_affineJobCount == 0)
+        return no_worker;
+
+    // Threads without a queue help with any job
+    size_t threshold    = worker == no_worker ? 1 : std::max(_options.affinity_steal_threshold, size_t(1));
+    size_t victim       = no_worker;
+    size_t victimJobs   = 0;
+
+    for (size_t i = 0; i < _workers.size(); ++i)
+    {
+        size_t jobs = _workers[i].jobs.size();
+
+        // A worker blocked by a job it posted to itself is behind with any job waiting
+        bool behind = jobs >= threshold || (jobs > 0 && _workers[i].stall == _Stall::stalled);
+
+        if (i != worker && behind && jobs > victimJobs)
+        {
+            victim      = i;
+            victimJobs  = jobs;
+        }
+    }
+
+    return victim;
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_check_stalls()
+{
+    for (_Worker& target : _workers)
+    {
+        if (target.stall == _Stall::posted)
+            target.stall = _Stall::checked;
+        else if (target.stall == _Stall::checked)
+            target.stall = _Stall::stalled;
+    }
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_clear_stall(size_t worker)
+{
+    _Worker& self = _workers[worker];
+
+    if (self.stall == _Stall::none)
+        return;
+
+    self.stall = _Stall::none;
+    --_watchedWorkers;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_wait_for_work(std::unique_lock<std::mutex>& lock, size_t worker, bool timed)
+{
+    if (worker == no_worker)
+    {
+        if (!timed)
+        {
+            _pendingJobsCV.wait(lock);
+            return true;
+        }
+
+        return _pendingJobsCV.wait_for(lock, _stall_check_interval) == std::cv_status::no_timeout;
+    }
+
+    _Worker& self   = _workers[worker];
+    bool woken      = true;
+
+    self.idle = true;
+    _idleWorkers.push_back(worker);
+
+    if (timed)
+        woken = self.ready.wait_for(lock, _stall_check_interval) == std::cv_status::no_timeout;
+    else
+        self.ready.wait(lock);
+
+    // Spurious wake-up or timeout, still on the idle list
+    if (self.idle)
+    {
+        _idleWorkers.erase(std::find(_idleWorkers.begin(), _idleWorkers.end(), worker));
+    }
+
+    return woken;
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_wake_worker(size_t worker)
+{
+    _Worker& target = _workers[worker];
+
+    if (!target.idle)
+        return;
+
+    target.idle = false;
+    _idleWorkers.erase(std::find(_idleWorkers.begin(), _idleWorkers.end(), worker));
+    target.ready.notify_one();
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_wake_one()
+{
+    if (_idleWorkers.empty())
+    {
+        _pendingJobsCV.notify_one();
+        return;
+    }
+
+    // A worker kept waiting with jobs of its own (reserved workers) goes first
+    for (size_t worker : _idleWorkers)
+    {
+        if (!_workers[worker].jobs.empty())
+        {
+            _wake_worker(worker);
+            return;
+        }
+    }
+
+    // Longest idle first, waking the one that just went idle makes it ping-pong with the producer
+    _wake_worker(_idleWorkers.front());
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_wake_all()
+{
+    _pendingJobsCV.notify_all();
+
+    for (size_t worker : _idleWorkers)
+    {
+        _workers[worker].idle = false;
+        _workers[worker].ready.notify_one();
+    }
+
+    _idleWorkers.clear();
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_execute(const detail::priority_job& job)
+{
+    try
+    {
+        job();
+    }
+    catch (...)
+    {
+        report_exception(std::current_exception());
+    }
+
+    // Count work done (even if throws)
+    ++_jobsDone;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_meets_deadline(const detail::priority_job& job)
+{
+    // Jobs without deadline don't read the clock
+    if (job.get_deadline() == detail::priority_job::no_deadline ||
+        job.get_deadline() >= detail::priority_job::clock_type::now())
+        return true;
+
+    ++_deadlineMisses[detail::priority_band(job.get_priority())];
+
+    if (_options.deadline_miss_handler)
+        _options.deadline_miss_handler(job.get_priority());
+
+    return false;
+}
+
+
+template<class Policy>
+bool scheduler<Policy>::_reactor_has_work() const
+{
+#ifdef SYNC_HAS_EPOLL
+    return _reactor && _reactor->watch_count() > 0;
+#else
+    return false;
+#endif  // SYNC_HAS_EPOLL
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_poll_reactor(std::unique_lock<std::mutex>& lock, int timeoutMs)
+{
+#ifdef SYNC_HAS_EPOLL
+    _reactorPolling = true;
+    _jobsSincePoll  = 0;
+
+    lock.unlock();
+    _reactor->poll(timeoutMs, _readyJobs);
+    lock.lock();
+
+    _reactorPolling = false;
+
+    // Handlers are not subject to capacity limits, the descriptor stays disarmed until its handler runs
+    for (auto& job : _readyJobs)
+        _push(std::move(job));
+
+    _readyJobs.clear();
+
+    // Let an idle thread take over the reactor
+    _wake_one();
+#else
+    (void)lock;
+    (void)timeoutMs;
+#endif  // SYNC_HAS_EPOLL
+}
+
+
+template<class Policy>
+void scheduler<Policy>::_interrupt_reactor()
+{
+#ifdef SYNC_HAS_EPOLL
+    if (_reactorPolling)
+        _reactor->interrupt();
+#endif  // SYNC_HAS_EPOLL
 }
 
 
@@ -0,0 +1,174 @@
+#ifndef SYNC_DETAIL_IMPL_SCHEDULING_POLICY_IPP
+#define SYNC_DETAIL_IMPL_SCHEDULING_POLICY_IPP
+
+#include <algorithm>
+
+#include "sync/scheduling_policy.hpp"
+
+
+SYNC_BEGIN
+
+
+bool fifo_policy::empty() const
+{
+    return _size == 0;
+}
+
+
+size_t fifo_policy::size() const
+{
+    return _size;
+}
+
+
+void fifo_policy::push(detail::priority_job&& job)
+{
+    if (_size == _jobs.size())
+        _grow();
+
+    _jobs[(_head + _size) % _jobs.size()] = std::move(job);
+    ++_size;
+}
+
+
+detail::priority_job fifo_policy::pop()
+{
+    detail::priority_job job = std::move(_jobs[_head]);
+
+    _head = (_head + 1) % _jobs.size();
+    --_size;
+
+    return job;
+}
+
+
+void fifo_policy::_grow()
+{
+    std::vector<detail::priority_job> jobs(std::max(_jobs.size() * 2, size_t(16)));
+
+    // Unwrap the ring into the new storage
+    for (size_t i = 0; i < _size; ++i)
+        jobs[i] = std::move(_jobs[(_head + i) % _jobs.size()]);
+
+    _jobs   = std::move(jobs);
+    _head   = 0;
+}
+
+
+// =============================================================================================
+
+
+bool lifo_policy::empty() const
+{
+    return _jobs.empty();
+}
+
+
+size_t lifo_policy::size() const
+{
+    return _jobs.size();
+}
+
+
+void lifo_policy::push(detail::priority_job&& job)
+{
+    _jobs.push_back(std::move(job));
+}
+
+
+detail::priority_job lifo_policy::pop()
+{
+    detail::priority_job job = std::move(_jobs.back());
+    _jobs.pop_back();
+    return job;
+}
+
+
+// =============================================================================================
+
+
+bool priority_policy::empty() const
+{
+    return _jobs.empty();
+}
+
+
+size_t priority_policy::size() const
+{
+    return _jobs.size();
+}
+
+
+void priority_policy::push(detail::priority_job&& job)
+{
+    job.stamp(detail::priority_job::clock_type::now());
+    _jobs.push_back(std::move(job));
+    std::push_heap(_jobs.begin(), _jobs.end(), &priority_policy::_less_urgent);
+}
+
+
+detail::priority_job priority_policy::pop()
+{
+    std::pop_heap(_jobs.begin(), _jobs.end(), &priority_policy::_less_urgent);
+    detail::priority_job job = std::move(_jobs.back());
+    _jobs.pop_back();
+    return job;
+}
+
+
+bool priority_policy::_less_urgent(const detail::priority_job& left, const detail::priority_job& right)
+{
+    auto leftLevel  = std::chrono::seconds(static_cast<uint8_t>(left.get_priority()));
+    auto rightLevel = std::chrono::seconds(static_cast<uint8_t>(right.get_priority()));
+
+    auto leftUrgency  = std::min(left.get_timestamp() + leftLevel, left.get_deadline());
+    auto rightUrgency = std::min(right.get_timestamp() + rightLevel, right.get_deadline());
+
+    return leftUrgency > rightUrgency;
+}
+
+
+// =============================================================================================
+
+
+bool edf_policy::empty() const
+{
+    return _jobs.empty();
+}
+
+
+size_t edf_policy::size() const
+{
+    return _jobs.size();
+}
+
+
+void edf_policy::push(detail::priority_job&& job)
+{
+    _jobs.push_back(_Entry{std::move(job), _sequence++});
+    std::push_heap(_jobs.begin(), _jobs.end(), &edf_policy::_less_urgent);
+}
+
+
+detail::priority_job edf_policy::pop()
+{
+    std::pop_heap(_jobs.begin(), _jobs.end(), &edf_policy::_less_urgent);
+    detail::priority_job job = std::move(_jobs.back().job);
+    _jobs.pop_back();
+    return job;
+}
+
+
+bool edf_policy::_less_urgent(const _Entry& left, const _Entry& right)
+{
+    if (left.job.get_deadline() != right.job.get_deadline())
+        return left.job.get_deadline() > right.job.get_deadline();
+
+    return left.sequence > right.sequence;
+}
+
+
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_SCHEDULING_POLICY_IPP
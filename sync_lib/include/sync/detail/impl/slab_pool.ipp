@@ -0,0 +1,250 @@
+#ifndef SYNC_DETAIL_IMPL_SLAB_POOL_IPP
+#define SYNC_DETAIL_IMPL_SLAB_POOL_IPP
+
+#include <cstdint>
+#include <new>
+
+#include "sync/detail/slab_pool.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+void* slab_pool::allocate(size_t bytes)
+{
+    size_t sizeClass = size_class(bytes);
+
+    if (slab_cache* cache = _local_cache())
+        return cache->allocate(sizeClass);
+
+    // Thread is exiting, borrow a cache for this call
+    slab_cache* cache = _adopt();
+
+    if (cache == nullptr)
+        throw std::bad_alloc();
+
+    try
+    {
+        void* ptr = cache->allocate(sizeClass);
+        _abandon(cache);
+        return ptr;
+    }
+    catch (...)
+    {
+        _abandon(cache);
+        throw;
+    }
+}
+
+
+void slab_pool::deallocate(void* ptr, size_t bytes) noexcept
+{
+    size_t sizeClass = size_class(bytes);
+
+    if (slab_cache* cache = _local_cache())
+    {
+        cache->deallocate(ptr, sizeClass);
+        return;
+    }
+
+    // No cache to collect the block, return it now
+    slab_block* block = ::new (ptr) slab_block{nullptr};
+    slab_cache::owner_of(ptr)->push_remote(sizeClass, block, block);
+}
+
+
+slab_pool::_ThreadGuard::~_ThreadGuard()
+{
+    _thread_exiting() = true;
+
+    if (slab_cache* cache = _thread_cache())
+    {
+        cache->flush();
+        _abandon(cache);
+        _thread_cache() = nullptr;
+    }
+}
+
+
+slab_cache*& slab_pool::_thread_cache() noexcept
+{
+    static thread_local slab_cache* cache = nullptr;
+    return cache;
+}
+
+
+bool& slab_pool::_thread_exiting() noexcept
+{
+    static thread_local bool exiting = false;
+    return exiting;
+}
+
+
+slab_cache* slab_pool::_local_cache() noexcept
+{
+    slab_cache*& cache = _thread_cache();
+
+    if (cache == nullptr && !_thread_exiting())
+    {
+        // First use in this thread: register the exit cleanup, then attach
+        static thread_local _ThreadGuard guard;
+        (void)guard;
+
+        cache = _adopt();
+    }
+
+    return cache;
+}
+
+
+slab_pool::_AbandonedList& slab_pool::_abandoned() noexcept
+{
+    static _AbandonedList list;
+    return list;
+}
+
+
+slab_cache* slab_pool::_adopt() noexcept
+{
+    _AbandonedList& list = _abandoned();
+
+    {
+        std::lock_guard lock(list.mtx);
+
+        if (slab_cache* cache = list.head)
+        {
+            list.head = cache->next_abandoned;
+            cache->next_abandoned = nullptr;
+            return cache;
+        }
+    }
+
+    return new (std::nothrow) slab_cache();
+}
+
+
+void slab_pool::_abandon(slab_cache* cache) noexcept
+{
+    _AbandonedList& list = _abandoned();
+
+    std::lock_guard lock(list.mtx);
+    cache->next_abandoned = list.head;
+    list.head = cache;
+}
+
+
+// =============================================================================================
+
+
+void* slab_cache::allocate(size_t sizeClass)
+{
+    slab_block* block = _freeBlocks[sizeClass];
+
+    // Local list is empty, take everything other threads gave back
+    if (block == nullptr)
+        block = _remoteBlocks[sizeClass].exchange(nullptr, std::memory_order_acquire);
+
+    if (block == nullptr)
+        return _carve(sizeClass);
+
+    _freeBlocks[sizeClass] = block->next;
+    return block;
+}
+
+
+void slab_cache::deallocate(void* ptr, size_t sizeClass) noexcept
+{
+    slab_block* block   = ::new (ptr) slab_block{nullptr};
+    slab_cache* owner   = owner_of(ptr);
+
+    if (owner == this)
+    {
+        block->next = _freeBlocks[sizeClass];
+        _freeBlocks[sizeClass] = block;
+        return;
+    }
+
+    _Batch& batch = _outgoing[sizeClass];
+
+    // A batch holds blocks of a single owner
+    if (batch.owner != owner)
+    {
+        _flush(sizeClass);
+        batch.owner = owner;
+    }
+
+    block->next = batch.head;
+    batch.head  = block;
+
+    if (batch.tail == nullptr)
+        batch.tail = block;
+
+    if (++batch.count == slab_pool::batch_size)
+        _flush(sizeClass);
+}
+
+
+void slab_cache::flush() noexcept
+{
+    for (size_t sizeClass = 0; sizeClass < slab_pool::size_class_count; ++sizeClass)
+        _flush(sizeClass);
+}
+
+
+void slab_cache::push_remote(size_t sizeClass, slab_block* head, slab_block* tail) noexcept
+{
+    slab_block* oldHead = _remoteBlocks[sizeClass].load(std::memory_order_relaxed);
+
+    do
+    {
+        tail->next = oldHead;
+    }
+    while (!_remoteBlocks[sizeClass].compare_exchange_weak(oldHead, head, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+slab_cache* slab_cache::owner_of(void* ptr) noexcept
+{
+    // The chunk header occupies the first block of the chunk
+    auto chunk = reinterpret_cast<std::uintptr_t>(ptr) & ~static_cast<std::uintptr_t>(slab_pool::chunk_size - 1);
+    return *reinterpret_cast<slab_cache**>(chunk);
+}
+
+
+void* slab_cache::_carve(size_t sizeClass)
+{
+    size_t blockSize = slab_pool::block_size(sizeClass);
+
+    if (_carveBegin[sizeClass] == _carveEnd[sizeClass])
+    {
+        char* chunk = static_cast<char*>(::operator new(slab_pool::chunk_size, std::align_val_t(slab_pool::chunk_size)));
+        ::new (chunk) slab_cache*(this);
+
+        _carveBegin[sizeClass]  = chunk + blockSize;
+        _carveEnd[sizeClass]    = chunk + slab_pool::chunk_size;
+    }
+
+    void* ptr = _carveBegin[sizeClass];
+    _carveBegin[sizeClass] += blockSize;
+
+    return ptr;
+}
+
+
+void slab_cache::_flush(size_t sizeClass) noexcept
+{
+    _Batch& batch = _outgoing[sizeClass];
+
+    if (batch.head != nullptr)
+        batch.owner->push_remote(sizeClass, batch.head, batch.tail);
+
+    batch = _Batch{};
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_SLAB_POOL_IPP
@@ -0,0 +1,44 @@
+#ifndef SYNC_DETAIL_IMPL_SLAB_RESOURCE_IPP
+#define SYNC_DETAIL_IMPL_SLAB_RESOURCE_IPP
+
+#include "sync/slab_resource.hpp"
+
+
+SYNC_BEGIN
+
+
+void* slab_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    if (detail::slab_pool::is_pooled(bytes, alignment))
+        return detail::slab_pool::allocate(bytes);
+
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+
+void slab_resource::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    if (detail::slab_pool::is_pooled(bytes, alignment))
+        detail::slab_pool::deallocate(ptr, bytes);
+    else
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+}
+
+
+bool slab_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return dynamic_cast<const slab_resource*>(&other) != nullptr;
+}
+
+
+slab_resource* default_slab_resource() noexcept
+{
+    static slab_resource resource;
+    return &resource;
+}
+
+
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_SLAB_RESOURCE_IPP
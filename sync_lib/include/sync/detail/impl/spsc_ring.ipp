@@ -0,0 +1,154 @@
+#ifndef SYNC_DETAIL_IMPL_SPSC_RING_IPP
+#define SYNC_DETAIL_IMPL_SPSC_RING_IPP
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+#include "sync/detail/spsc_ring.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+template<class T>
+spsc_ring<T>::spsc_ring(size_t capacity)
+    :   _slots(new _Slot[std::bit_ceil(capacity < 2 ? size_t(2) : capacity)]),
+        _mask(std::bit_ceil(capacity < 2 ? size_t(2) : capacity) - 1)
+{
+    // Empty
+}
+
+
+template<class T>
+spsc_ring<T>::~spsc_ring()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (size_t pos = _head; pos != _tail; ++pos)
+            _value_at(pos)->~T();
+    }
+}
+
+
+template<class T>
+bool spsc_ring<T>::try_push(T&& value) noexcept
+{
+    size_t tail = _tail.load(std::memory_order_relaxed);
+
+    if (tail - _cachedHead > _mask)
+    {
+        _cachedHead = _head.load(std::memory_order_acquire);
+
+        if (tail - _cachedHead > _mask)
+            return false;
+    }
+
+    ::new (static_cast<void*>(_slots[tail & _mask].storage)) T(std::move(value));
+    _tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+
+template<class T>
+bool spsc_ring<T>::try_pop(T& value) noexcept
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+
+    if (head == _cachedTail)
+    {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+        if (head == _cachedTail)
+            return false;
+    }
+
+    T* stored = _value_at(head);
+
+    value = std::move(*stored);
+    stored->~T();
+
+    _head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+
+template<class T>
+template<class InputIt>
+size_t spsc_ring<T>::try_push_batch(InputIt first, size_t count) noexcept
+{
+    size_t tail = _tail.load(std::memory_order_relaxed);
+
+    if (_mask + 1 - (tail - _cachedHead) < count)
+        _cachedHead = _head.load(std::memory_order_acquire);
+
+    count = std::min(count, _mask + 1 - (tail - _cachedHead));
+
+    for (size_t i = 0; i < count; ++i, ++first)
+        ::new (static_cast<void*>(_slots[(tail + i) & _mask].storage)) T(std::move(*first));
+
+    if (count > 0)
+        _tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
+
+template<class T>
+template<class OutputIt>
+size_t spsc_ring<T>::try_pop_batch(OutputIt out, size_t maxCount)
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+
+    if (_cachedTail - head < maxCount)
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+    size_t count = std::min(maxCount, _cachedTail - head);
+
+    for (size_t i = 0; i < count; ++i, ++out)
+    {
+        T* stored = _value_at(head + i);
+
+        *out = std::move(*stored);
+        stored->~T();
+    }
+
+    if (count > 0)
+        _head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
+
+template<class T>
+size_t spsc_ring<T>::capacity() const noexcept
+{
+    return _mask + 1;
+}
+
+
+template<class T>
+size_t spsc_ring<T>::size_approx() const noexcept
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+    size_t tail = _tail.load(std::memory_order_relaxed);
+
+    return tail > head ? tail - head : 0;
+}
+
+
+template<class T>
+T* spsc_ring<T>::_value_at(size_t pos) noexcept
+{
+    return std::launder(reinterpret_cast<T*>(_slots[pos & _mask].storage));
+}
+
+
+DETAIL_END
+SYNC_END
+
+
+#endif  // SYNC_DETAIL_IMPL_SPSC_RING_IPP
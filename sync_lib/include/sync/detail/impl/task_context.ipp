@@ -7,49 +7,120 @@
 SYNC_BEGIN
 
 
-task_context::task_context()
+template<class Policy>
+basic_task_context<Policy>::basic_task_context()
+    : basic_task_context(queue_options{}) { /* Empty */ }
+
+
+template<class Policy>
+basic_task_context<Policy>::basic_task_context(const queue_options& options)
+    : _scheduler(options)
 {
     _scheduler.restart();
     _scheduler.forbid_wait();
 }
 
 
-task_context::~task_context()
+template<class Policy>
+basic_task_context<Policy>::~basic_task_context()
 {
     // Empty - scheduler stops by default
 }
 
 
-basic_executor& task_context::get_executor()
+template<class Policy>
+basic_executor& basic_task_context<Policy>::get_executor()
 {
     return _scheduler;
 }
 
 
-bool task_context::stopped() const
+template<class Policy>
+bool basic_task_context<Policy>::running_in_this_thread() const
+{
+    return _scheduler.running_in_this_thread();
+}
+
+
+template<class Policy>
+bool basic_task_context<Policy>::stopped() const
 {
     return _scheduler.stopped();
 }
 
 
-void task_context::restart()
+template<class Policy>
+size_t basic_task_context<Policy>::jobs_done() const
+{
+    return _scheduler.jobs_done();
+}
+
+
+template<class Policy>
+size_t basic_task_context<Policy>::rejected_posts() const
+{
+    return _scheduler.rejected_posts();
+}
+
+
+template<class Policy>
+size_t basic_task_context<Policy>::blocked_posts() const
+{
+    return _scheduler.blocked_posts();
+}
+
+
+template<class Policy>
+size_t basic_task_context<Policy>::deadline_misses() const
+{
+    return _scheduler.deadline_misses();
+}
+
+
+template<class Policy>
+size_t basic_task_context<Policy>::deadline_misses(priority prio) const
+{
+    return _scheduler.deadline_misses(prio);
+}
+
+
+template<class Policy>
+void basic_task_context<Policy>::restart()
 {
     _scheduler.restart();
 }
 
 
-void task_context::run()
+template<class Policy>
+void basic_task_context<Policy>::run()
 {
     _scheduler.run();
 }
 
 
-void task_context::stop()
+template<class Policy>
+void basic_task_context<Policy>::stop()
 {
     _scheduler.stop();
 }
 
 
+#ifdef SYNC_HAS_EPOLL
+template<class Policy>
+void basic_task_context<Policy>::watch(int fd, io_event events, std::function<void(io_event)> handler, priority prio)
+{
+    _scheduler.watch(fd, events, prio, std::move(handler));
+}
+
+
+template<class Policy>
+bool basic_task_context<Policy>::unwatch(int fd)
+{
+    return _scheduler.unwatch(fd);
+}
+#endif  // SYNC_HAS_EPOLL
+
+
 SYNC_END
 
 
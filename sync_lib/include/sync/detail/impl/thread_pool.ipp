@@ -7,66 +7,139 @@
 SYNC_BEGIN
 
 
-thread_pool::thread_pool(size_t nthreads)
+template<class Policy>
+basic_thread_pool<Policy>::basic_thread_pool(size_t nthreads)
+    : basic_thread_pool(nthreads, queue_options{}) { /* Empty */ }
+
+
+template<class Policy>
+basic_thread_pool<Policy>::basic_thread_pool(size_t nthreads, const queue_options& options)
+    : _scheduler(options)
 {
     _SYNC_ASSERT(nthreads > 0, "Pool cannot have 0 threads!");
 
     _scheduler.restart();
     _scheduler.allow_wait();
+    _scheduler.set_worker_count(nthreads);
     _threads.reserve(nthreads);
 
-    while (nthreads--)
+    for (size_t worker = 0; worker < nthreads; ++worker)
     {
-        std::jthread t(&detail::scheduler::run, &_scheduler);
+        std::jthread t([this, worker]() { _scheduler.run(worker); });
         _threads.push_back(std::move(t));
     }
 }
 
 
-thread_pool::~thread_pool()
+template<class Policy>
+basic_thread_pool<Policy>::~basic_thread_pool()
 {
     join();
 }
 
 
-basic_executor& thread_pool::get_executor()
+template<class Policy>
+basic_executor& basic_thread_pool<Policy>::get_executor()
 {
     return _scheduler;
 }
 
 
-size_t thread_pool::thread_count() const
+template<class Policy>
+size_t basic_thread_pool<Policy>::thread_count() const
 {
     return _threads.size();
 }
 
 
-size_t thread_pool::jobs_done() const
+template<class Policy>
+size_t basic_thread_pool<Policy>::jobs_done() const
 {
     return _scheduler.jobs_done();
 }
 
 
-bool thread_pool::stopped() const
+template<class Policy>
+size_t basic_thread_pool<Policy>::rejected_posts() const
+{
+    return _scheduler.rejected_posts();
+}
+
+
+template<class Policy>
+size_t basic_thread_pool<Policy>::blocked_posts() const
+{
+    return _scheduler.blocked_posts();
+}
+
+
+template<class Policy>
+size_t basic_thread_pool<Policy>::stolen_jobs() const
+{
+    return _scheduler.stolen_jobs();
+}
+
+
+template<class Policy>
+size_t basic_thread_pool<Policy>::deadline_misses() const
+{
+    return _scheduler.deadline_misses();
+}
+
+
+template<class Policy>
+size_t basic_thread_pool<Policy>::deadline_misses(priority prio) const
+{
+    return _scheduler.deadline_misses(prio);
+}
+
+
+template<class Policy>
+bool basic_thread_pool<Policy>::running_in_this_thread() const
+{
+    return _scheduler.running_in_this_thread();
+}
+
+
+template<class Policy>
+bool basic_thread_pool<Policy>::stopped() const
 {
     return _scheduler.stopped();
 }
 
 
-void thread_pool::stop()
+template<class Policy>
+void basic_thread_pool<Policy>::stop()
 {
     _scheduler.stop();
     _scheduler.forbid_wait();
 }
 
 
-void thread_pool::join()
+template<class Policy>
+void basic_thread_pool<Policy>::join()
 {
     _scheduler.stop();
     _threads.clear();
 }
 
 
+#ifdef SYNC_HAS_EPOLL
+template<class Policy>
+void basic_thread_pool<Policy>::watch(int fd, io_event events, std::function<void(io_event)> handler, priority prio)
+{
+    _scheduler.watch(fd, events, prio, std::move(handler));
+}
+
+
+template<class Policy>
+bool basic_thread_pool<Policy>::unwatch(int fd)
+{
+    return _scheduler.unwatch(fd);
+}
+#endif  // SYNC_HAS_EPOLL
+
+
 SYNC_END
 
 
@@ -0,0 +1,213 @@
+#ifndef SYNC_DETAIL_JOB_FUNCTION_HPP
+#define SYNC_DETAIL_JOB_FUNCTION_HPP
+
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "sync/detail/core.hpp"
+#include "sync/slab_resource.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief Type erased operations of a callable stored in `job_function`
+ */
+struct job_operations
+{
+    void (*invoke)(void* target);
+    void (*relocate)(void* destination, void* source) noexcept;     // `nullptr` if stored in memory resource
+    void (*destroy)(void* target, std::pmr::memory_resource* resource) noexcept;
+};  // END job_operations
+
+
+/**
+ * @brief Move-only `void()` callable wrapper.
+ * Small callables are stored inline, larger ones in the given memory resource.
+ */
+class job_function
+{
+private:
+    // Inline storage size
+    static constexpr size_t _buffer_size = 6 * sizeof(void*);
+
+    // Inline storage
+    alignas(std::max_align_t) unsigned char _buffer[_buffer_size];
+
+    // Operations of the stored callable, `nullptr` if empty
+    const job_operations* _ops = nullptr;
+
+    // Stored callable (inline buffer or memory resource)
+    void* _target = nullptr;
+
+    // Memory resource for callables too big for the inline buffer
+    std::pmr::memory_resource* _resource = nullptr;
+
+public:
+
+    job_function() noexcept = default;
+
+    SYNC_DECL ~job_function();
+
+    /**
+     * @brief Store a callable. Memory, if needed, is taken from `sync::default_slab_resource()`.
+     */
+    template<class Callable, std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, job_function>, bool> = true>
+    job_function(Callable&& callable)
+        : job_function(std::allocator_arg, default_slab_resource(), std::in_place_type<std::decay_t<Callable>>, std::forward<Callable>(callable)) { /* Empty */ }
+
+    /**
+     * @brief Construct a callable of type `Callable` in place
+     * @param resource memory used if the callable does not fit inline
+     * @param args constructor arguments
+     */
+    template<class Callable, class... CtorArgs>
+    job_function(std::allocator_arg_t, std::pmr::memory_resource* resource, std::in_place_type_t<Callable>, CtorArgs&&... args);
+
+    /**
+     * @brief Delete copy constructor and operator
+     */
+    job_function(const job_function&)             = delete;
+    job_function& operator=(const job_function&)  = delete;
+
+    SYNC_DECL job_function(job_function&& other) noexcept;
+    SYNC_DECL job_function& operator=(job_function&& other) noexcept;
+
+public:
+
+    /**
+     * @brief Call the stored callable
+     * @throw `std::bad_function_call` if empty
+     */
+    SYNC_DECL void operator()(void) const;
+
+    /**
+     * @brief Returns `true` if a callable is stored
+     */
+    SYNC_DECL explicit operator bool() const noexcept;
+
+    /**
+     * @brief Access the stored callable. The type must match the stored one.
+     */
+    template<class Callable>
+    Callable* target() noexcept;
+
+private:
+
+    template<class Callable>
+    static constexpr bool _stored_inline =  sizeof(Callable) <= _buffer_size &&
+                                            alignof(Callable) <= alignof(std::max_align_t) &&
+                                            std::is_nothrow_move_constructible_v<Callable>;
+
+    template<class Callable>
+    static void _invoke(void* target);
+
+    template<class Callable>
+    static void _relocate(void* destination, void* source) noexcept;
+
+    template<class Callable>
+    static void _destroy(void* target, std::pmr::memory_resource* resource) noexcept;
+
+    template<class Callable>
+    static const job_operations* _operations() noexcept;
+
+    /**
+     * @brief Destroy the stored callable
+     */
+    SYNC_DECL void _reset() noexcept;
+
+    /**
+     * @brief Ownership transfer algorithm
+     * @param other object from where to get data
+     */
+    SYNC_DECL void _move(job_function&& other) noexcept;
+};  // END job_function
+
+
+template<class Callable, class... CtorArgs>
+job_function::job_function(std::allocator_arg_t, std::pmr::memory_resource* resource, std::in_place_type_t<Callable>, CtorArgs&&... args)
+    : _resource(resource)
+{
+    if constexpr (_stored_inline<Callable>)
+    {
+        _target = ::new (static_cast<void*>(_buffer)) Callable(std::forward<CtorArgs>(args)...);
+    }
+    else
+    {
+        void* memory = _resource->allocate(sizeof(Callable), alignof(Callable));
+
+        try
+        {
+            _target = ::new (memory) Callable(std::forward<CtorArgs>(args)...);
+        }
+        catch (...)
+        {
+            _resource->deallocate(memory, sizeof(Callable), alignof(Callable));
+            throw;
+        }
+    }
+
+    _ops = _operations<Callable>();
+}
+
+
+template<class Callable>
+Callable* job_function::target() noexcept
+{
+    return static_cast<Callable*>(_target);
+}
+
+
+template<class Callable>
+void job_function::_invoke(void* target)
+{
+    (*static_cast<Callable*>(target))();
+}
+
+
+template<class Callable>
+void job_function::_relocate(void* destination, void* source) noexcept
+{
+    Callable* sourceCallable = static_cast<Callable*>(source);
+
+    ::new (destination) Callable(std::move(*sourceCallable));
+    sourceCallable->~Callable();
+}
+
+
+template<class Callable>
+void job_function::_destroy(void* target, std::pmr::memory_resource* resource) noexcept
+{
+    static_cast<Callable*>(target)->~Callable();
+
+    if constexpr (!_stored_inline<Callable>)
+        resource->deallocate(target, sizeof(Callable), alignof(Callable));
+}
+
+
+template<class Callable>
+const job_operations* job_function::_operations() noexcept
+{
+    static constexpr job_operations operations = {
+        &job_function::_invoke<Callable>,
+        _stored_inline<Callable> ? &job_function::_relocate<Callable> : nullptr,
+        &job_function::_destroy<Callable>
+    };
+
+    return &operations;
+}
+
+
+DETAIL_END
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/job_function.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_DETAIL_JOB_FUNCTION_HPP
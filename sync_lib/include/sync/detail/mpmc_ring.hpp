@@ -0,0 +1,104 @@
+#ifndef SYNC_DETAIL_MPMC_RING_HPP
+#define SYNC_DETAIL_MPMC_RING_HPP
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "sync/detail/core.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue (Vyukov).
+ * Each slot has a sequence number telling whose turn it is (producer of round `n` or consumer of round `n`),
+ * so producers and consumers only contend on their own position counter.
+ * @tparam T nothrow movable value type
+ * @note Capacity is rounded up to a power of 2
+ */
+template<class T>
+class mpmc_ring
+{
+private:
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                    "mpmc_ring requires nothrow move operations");
+
+    struct _Cell
+    {
+        std::atomic_size_t sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Ring storage
+    std::unique_ptr<_Cell[]> _cells;
+
+    // Capacity - 1
+    size_t _mask;
+
+    // Next position to write
+    alignas(cache_line_size) std::atomic_size_t _enqueuePos = 0;
+
+    // Next position to read
+    alignas(cache_line_size) std::atomic_size_t _dequeuePos = 0;
+
+public:
+
+    /**
+     * @param capacity minimum number of values held, at least 2
+     */
+    explicit mpmc_ring(size_t capacity);
+
+    ~mpmc_ring();
+
+    mpmc_ring(const mpmc_ring&)             = delete;
+    mpmc_ring& operator=(const mpmc_ring&)  = delete;
+
+public:
+
+    /**
+     * @brief Move `value` in the ring
+     * @return `false` if full (`value` is left untouched)
+     */
+    bool try_push(T&& value) noexcept;
+
+    /**
+     * @brief Move the oldest value to `value`
+     * @return `false` if empty
+     */
+    bool try_pop(T& value) noexcept;
+
+    /**
+     * @brief Move up to `count` values starting at `first` in the ring
+     * @return Number of values pushed (the rest are left untouched)
+     */
+    template<class InputIt>
+    size_t try_push_batch(InputIt first, size_t count) noexcept;
+
+    /**
+     * @brief Move up to `maxCount` values to `out`
+     * @return Number of values popped
+     */
+    template<class OutputIt>
+    size_t try_pop_batch(OutputIt out, size_t maxCount);
+
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Number of values, exact only if no push or pop is in progress
+     */
+    size_t size_approx() const noexcept;
+
+private:
+    T* _value_of(_Cell& cell) noexcept;
+};  // END mpmc_ring
+
+
+DETAIL_END
+SYNC_END
+
+#include "sync/detail/impl/mpmc_ring.ipp"
+
+#endif  // SYNC_DETAIL_MPMC_RING_HPP
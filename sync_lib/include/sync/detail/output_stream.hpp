@@ -1,6 +1,7 @@
 #ifndef SYNC_DETAIL_OUTPUT_STREAM_HPP
 #define SYNC_DETAIL_OUTPUT_STREAM_HPP
 
+#include <ios>
 #include <type_traits>
 #include <memory>
 
@@ -86,9 +87,9 @@ public:
 
 public:
 
-    bool good() const;
-    output_stream& flush();
-    output_stream& write(const char* c, std::streamsize n);
+    SYNC_DECL bool good() const;
+    SYNC_DECL output_stream& flush();
+    SYNC_DECL output_stream& write(const char* c, std::streamsize n);
 
 private:
     template<class OStreamType>
@@ -96,9 +97,63 @@ private:
 };  // END output_stream
 
 
+template<class OStreamType, class = void>
+struct _HasOStreamInterface : std::false_type {};
+
+
+template<class OStreamType>
+struct _HasOStreamInterface<OStreamType,
+                            std::void_t<decltype(std::declval<OStreamType>().good()),
+                                        decltype(std::declval<OStreamType>().flush()),
+                                        decltype(std::declval<OStreamType>().write(std::declval<const char*>(), std::declval<std::streamsize>()))
+                                        >
+                            > : std::true_type {};
+
+
+template<class OStreamType>
+constexpr bool _HasOStreamInterface_v = _HasOStreamInterface<OStreamType>::value;
+
+
+template<class OStreamType>
+bool output_stream_impl<OStreamType>::good() const noexcept
+{
+    return _ostreamRef.get().good();
+}
+
+
+template<class OStreamType>
+void output_stream_impl<OStreamType>::write(const char* c, std::streamsize n)
+{
+    (void)_ostreamRef.get().write(c, n);
+}
+
+
+template<class OStreamType>
+void output_stream_impl<OStreamType>::flush()
+{
+    (void)_ostreamRef.get().flush();
+}
+
+
+// =============================================================================================
+
+
+template<class OStreamType>
+void output_stream::_reset(OStreamType&& ostream)
+{
+    if constexpr (_HasOStreamInterface_v<std::decay_t<OStreamType>>)
+    {
+        using _OtherImpl = output_stream_impl<std::decay_t<OStreamType>>;
+        _storage = std::make_unique<_OtherImpl>(ostream);
+    }
+}
+
+
 DETAIL_END
 SYNC_END
 
-#include "sync/detail/impl/output_stream.ipp"
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/output_stream.ipp"
+#endif  // SYNC_HEADER_ONLY
 
 #endif  // SYNC_DETAIL_OUTPUT_STREAM_HPP
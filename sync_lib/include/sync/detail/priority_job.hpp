@@ -2,9 +2,11 @@
 #define SYNC_DETAIL_PRIORITY_JOB_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 
 #include "sync/detail/core.hpp"
+#include "sync/detail/job_function.hpp"
 
 
 SYNC_BEGIN
@@ -23,24 +25,88 @@ enum class priority : uint8_t
 };  // END priority
 
 
+/**
+ * @brief Key of tasks that should run on the same worker of a `thread_pool` (shard, connection, ...)
+ * @note Equal keys map to the same worker. Other workers take the tasks only if that worker falls behind.
+ */
+struct affinity
+{
+    // Hash of the user key
+    size_t key;
+
+    /**
+     * @brief Use the `std::hash` of `value` as key
+     */
+    template<class Key>
+    explicit affinity(const Key& value)
+        : key(std::hash<Key>{}(value)) { /* Empty */ }
+};  // END affinity
+
+
 DETAIL_BEGIN
 
 
+// Number of priority bands used for per priority accounting
+constexpr size_t priority_band_count = 5;
+
+
 /**
- * @brief Helper class to be integrated into a priority queue
+ * @brief Map a priority value to the band closed by a named priority: `highest` | (`highest`, `high`] | ... | (`low`, `lowest`]
+ * @return Band index in range [0, `priority_band_count`)
+ */
+constexpr size_t priority_band(priority prio) noexcept
+{
+    auto value = static_cast<uint8_t>(prio);
+
+    if (value <= static_cast<uint8_t>(priority::highest))
+        return 0;
+
+    if (value <= static_cast<uint8_t>(priority::high))
+        return 1;
+
+    if (value <= static_cast<uint8_t>(priority::medium))
+        return 2;
+
+    if (value <= static_cast<uint8_t>(priority::low))
+        return 3;
+
+    return 4;
+}
+
+
+/**
+ * @brief Job stored in the scheduler queue together with its scheduling data
+ * @note No clock is read here, the scheduling policy stamps the job if it needs to
  */
 class priority_job
 {
+public:
+
+    // Clock used for timestamps and deadlines
+    using clock_type = std::chrono::steady_clock;
+
+    // Value used for jobs without deadline
+    static constexpr clock_type::time_point no_deadline = clock_type::time_point::max();
+
+    // Value used for jobs without affinity key
+    static constexpr size_t no_affinity = SIZE_MAX;
+
 private:
 
     // User set priority
-    priority _prio;
+    priority _prio = priority::medium;
+
+    // Key of `sync::affinity`, `no_affinity` if any worker can run the job
+    size_t _affinity = no_affinity;
 
     // The actual job
-    std::function<void(void)> _job;
+    job_function _job;
 
-    // Insertion time
-    typename std::chrono::steady_clock::time_point _timestamp;
+    // Insertion time (set by the policy)
+    clock_type::time_point _timestamp;
+
+    // Time after which the job is no longer useful
+    clock_type::time_point _deadline = no_deadline;
 
 public:
 
@@ -51,10 +117,18 @@ public:
      * @brief Constructor that sets priority and job for this object
      * @note Job ownership is transfered
      */
-    SYNC_DECL priority_job(priority prio, std::function<void(void)>&& job)
+    SYNC_DECL priority_job(priority prio, job_function&& job)
+        :   _prio(prio),
+            _job(std::move(job)) { /* Empty */ }
+
+    /**
+     * @brief Constructor that sets priority, deadline and job for this object
+     * @note Job ownership is transfered
+     */
+    SYNC_DECL priority_job(priority prio, clock_type::time_point deadline, job_function&& job)
         :   _prio(prio),
             _job(std::move(job)),
-            _timestamp(std::chrono::steady_clock::now()) { /* Empty */ }
+            _deadline(deadline) { /* Empty */ }
 
     /**
      * @brief Delete copy constructor and operator
@@ -73,10 +147,34 @@ public:
     SYNC_DECL void operator()(void) const;
 
     /**
-     * @brief Number used by `operator<` for comparison in `std::priority_queue`
-     * @note Priority might be higher than the original due to wait time
+     * @brief Priority set by the user at construction
+     */
+    SYNC_DECL priority get_priority() const;
+
+    /**
+     * @brief Deadline set by the user at construction, `no_deadline` if none
      */
-    SYNC_DECL uint8_t effective_priority() const;
+    SYNC_DECL clock_type::time_point get_deadline() const;
+
+    /**
+     * @brief Affinity key set by `set_affinity()`, `no_affinity` if none
+     */
+    SYNC_DECL size_t get_affinity() const;
+
+    /**
+     * @brief Prefer the worker that runs the other jobs with the same key
+     */
+    SYNC_DECL void set_affinity(size_t key);
+
+    /**
+     * @brief Insertion time set by `stamp()`
+     */
+    SYNC_DECL clock_type::time_point get_timestamp() const;
+
+    /**
+     * @brief Set the insertion time used for aging
+     */
+    SYNC_DECL void stamp(clock_type::time_point now);
 
 private:
 
@@ -88,17 +186,6 @@ private:
 };  // END priority_job
 
 
-/**
- * @brief Operator used in `std::priority_queue` ordering
- * @param left, right object to compare
- * @note Lower numbers mean higher priority
- */
-inline bool operator<(const priority_job& left, const priority_job& right)
-{
-    return left.effective_priority() > right.effective_priority();
-}
-
-
 DETAIL_END
 SYNC_END
 
@@ -0,0 +1,311 @@
+#ifndef SYNC_DETAIL_RING_SCHEDULER_HPP
+#define SYNC_DETAIL_RING_SCHEDULER_HPP
+
+#include "sync/detail/mpmc_ring.hpp"
+#include "sync/detail/scheduler.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief Lock-free task executor selected by `basic_ring_policy`. Same interface and stop/wait rules as the generic `scheduler`.
+ * @note Jobs are posted and dequeued without lock. A thread finding every ring empty yields a few times, then parks on a
+ * condition variable; posts take the park mutex only if a thread is parked.
+ * @note Posting to a full queue follows `queue_options::overflow`, blocked producers park the same way. The total and band
+ * capacities are exact: a job is counted in atomic counters (only for the limits set) before it goes to its ring.
+ * @note `set_worker_count()` is only informative: worker reservation and affinity queues need the generic scheduler
+ * @note Unbounded options still give a bounded ring of `basic_ring_policy::default_capacity` (1024) slots, with the
+ * default `overflow_policy::reject`: replacing a generic policy by a ring one can make `sync::post()` throw under a burst.
+ * Set `queue_options::capacity` and `queue_options::overflow` for the expected load.
+ */
+template<bool PerPriority>
+class scheduler<basic_ring_policy<PerPriority>> : public basic_executor
+{
+private:
+    using _Ring = mpmc_ring<detail::priority_job>;
+
+    // Failed dequeue rounds before parking
+    static constexpr size_t _spin_count = 16;
+
+    // Rings by priority band (single ring if not `PerPriority`)
+    std::array<std::unique_ptr<_Ring>, basic_ring_policy<PerPriority>::ring_count> _rings;
+
+    // Capacity limits and overflow behavior
+    queue_options _options;
+
+    // Memory for task state
+    std::pmr::memory_resource* _taskResource = default_slab_resource();
+
+    // Guards parking, never held while jobs are posted or dequeued
+    std::mutex _parkMtx;
+
+    // Threads waiting for jobs
+    std::condition_variable _parkCV;
+
+    // Producers waiting for free space
+    std::condition_variable _freeSpaceCV;
+
+    // Number of threads waiting on `_parkCV`
+    alignas(cache_line_size) std::atomic_size_t _parkedThreads = 0;
+
+    // Number of producers waiting on `_freeSpaceCV`
+    std::atomic_size_t _blockedProducers = 0;
+
+    // Jobs in the rings, counted only if `queue_options::capacity` is set
+    alignas(cache_line_size) std::atomic_size_t _pendingJobs = 0;
+
+    // Jobs in the rings for each priority band, counted only for a band with a capacity
+    std::array<std::atomic_size_t, priority_band_count> _pendingJobsPerBand = {};
+
+    // Finished tasks counter
+    alignas(cache_line_size) std::atomic_size_t _jobsDone = 0;
+
+    // Posts refused because of a full queue
+    std::atomic_size_t _rejectedPosts = 0;
+
+    // Posts that had to wait for free space
+    std::atomic_size_t _blockedPosts = 0;
+
+    // Jobs dropped after their deadline, for each priority band
+    std::array<std::atomic_size_t, priority_band_count> _deadlineMisses = {};
+
+    // Flag used for stop state
+    std::atomic_bool _stop = false;
+
+    // Flag used to allow waiting for jobs
+    std::atomic_bool _wait = false;
+
+public:
+
+    // Value given to `run()` by threads that are not workers
+    static constexpr size_t no_worker = SIZE_MAX;
+
+public:
+
+    scheduler()
+        : scheduler(queue_options{}) { /* Empty */ }
+
+    /**
+     * @brief Construct scheduler with ring capacities taken from `options`
+     * @throw `std::invalid_argument` if `options` reserves workers
+     */
+    explicit scheduler(const queue_options& options);
+
+    ~scheduler() override;
+
+public:
+
+    /**
+     * @brief Used internally by `sync::post()` to submit tasks
+     * @throw `std::system_error` if the ring is full and the job cannot be accepted
+     */
+    void post(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::try_post()` to submit tasks without blocking
+     * @return `true` if the job was accepted, `false` if stopped or full (job is left untouched)
+     */
+    bool try_post(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::defer()` to submit continuations
+     * @note Called from a thread running this scheduler, the job runs on the same thread after the current job.
+     * Otherwise same as `post()`.
+     */
+    void defer(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::dispatch()` to submit tasks
+     * @note Called from a thread running this scheduler, the job runs immediately (up to `call_stack::max_dispatch_depth`
+     * nested calls). Otherwise same as `post()`.
+     */
+    void dispatch(detail::priority_job&& job) override;
+
+    /**
+     * @brief Returns `true` if the executor is stopped, `false` otherwise.
+     */
+    bool stopped() const override;
+
+    /**
+     * @brief Returns `true` if the calling thread is executing `run()` of this scheduler
+     */
+    bool running_in_this_thread() const override;
+
+    /**
+     * @brief Used internally by `sync::post()` to allocate task state
+     */
+    std::pmr::memory_resource* get_memory_resource() const override;
+
+    /**
+     * @brief Give an exception from a task of this scheduler to `queue_options::exception_handler`, if set
+     */
+    void report_exception(std::exception_ptr error) override;
+
+    /**
+     * @brief Return the number of tasks finished (even if they throw)
+     */
+    size_t jobs_done() const;
+
+    /**
+     * @brief Return the number of posts refused because of a full ring
+     */
+    size_t rejected_posts() const;
+
+    /**
+     * @brief Return the number of posts that waited for free space
+     */
+    size_t blocked_posts() const;
+
+    /**
+     * @brief Always 0, there are no worker queues
+     */
+    size_t stolen_jobs() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline (all priorities)
+     */
+    size_t deadline_misses() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline in the band of `prio`
+     */
+    size_t deadline_misses(priority prio) const;
+
+    /**
+     * @brief Stop the executor. Pending jobs finish before return if `allow_wait()` was called.
+     * Running jobs will continue.
+     */
+    void stop();
+
+    /**
+     * @brief Allow new calls for `run()`
+     */
+    void restart();
+
+    /**
+     * @brief Returns `true` if the executor can wait for new jobs if none pending, `false` otherwise.
+     */
+    bool allowed_to_wait() const;
+
+    /**
+     * @brief Threads executing `run()` are allowed to wait for new jobs if not stopped
+     * @note If stopped, the scheduler will finish pending jobs first.
+     */
+    void allow_wait();
+
+    /**
+     * @brief Threads executing `run()` exit if stopped or no jobs left
+     */
+    void forbid_wait();
+
+    /**
+     * @brief Start executing pending jobs
+     * @param worker ignored, all threads share the rings
+     * @note Can be started from multiple threads
+     */
+    void run(size_t worker = no_worker);
+
+    /**
+     * @brief Accepted for interface compatibility, the rings don't depend on the number of threads
+     */
+    void set_worker_count(size_t count);
+
+#ifdef SYNC_HAS_EPOLL
+    /**
+     * @brief Not supported by the lock-free backend
+     * @throw `std::system_error` with `std::errc::operation_not_supported`
+     */
+    void watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler);
+
+    /**
+     * @brief Nothing is watched
+     * @return `false`
+     */
+    bool unwatch(int fd);
+#endif  // SYNC_HAS_EPOLL
+
+private:
+
+    /**
+     * @brief Ring of the band of `prio`
+     */
+    _Ring& _ring_for(priority prio);
+
+    /**
+     * @brief Put the job in its ring without waking anyone
+     * @return `false` if full (job is left untouched)
+     */
+    bool _try_push(detail::priority_job& job);
+
+    /**
+     * @brief Take the oldest job of the highest non-empty band
+     * @return `false` if every ring is empty
+     */
+    bool _try_pop(detail::priority_job& job);
+
+    /**
+     * @brief Count a new job of `band` against the capacity limits that are set
+     * @return `false` if a limit is reached (nothing is counted)
+     */
+    bool _count_job(size_t band);
+
+    /**
+     * @brief Stop counting a job of `band` taken out of its ring
+     */
+    void _uncount_job(size_t band);
+
+    /**
+     * @brief Returns `true` if a ring holds (or is about to hold) jobs
+     */
+    bool _has_jobs() const;
+
+    /**
+     * @brief Wake a parked thread after a push, if any
+     */
+    void _wake_parked();
+
+    /**
+     * @brief Wake blocked producers after a pop, if any
+     */
+    void _wake_blocked_producers();
+
+    /**
+     * @brief Wait for a post, a stop or `forbid_wait()`
+     */
+    void _park();
+
+    /**
+     * @brief Wait until the job fits or `block_timeout` expires
+     * @return `true` if the job was accepted
+     * @throw `std::system_error` if stopped while waiting
+     */
+    bool _push_blocking(detail::priority_job& job);
+
+    /**
+     * @brief Run a job, report escaping exceptions and count it
+     */
+    void _execute(const detail::priority_job& job);
+
+    /**
+     * @brief Check the deadline of a job about to start. Count and report the miss if expired.
+     * @return `true` if the job can still run
+     */
+    bool _meets_deadline(const detail::priority_job& job);
+};  // END scheduler
+
+
+#ifdef SYNC_SEPARATE_COMPILATION
+// Built once in src/sync.cpp
+extern template class scheduler<ring_policy>;
+extern template class scheduler<fifo_ring_policy>;
+#endif  // SYNC_SEPARATE_COMPILATION
+
+
+DETAIL_END
+SYNC_END
+
+#include "sync/detail/impl/ring_scheduler.ipp"
+
+#endif  // SYNC_DETAIL_RING_SCHEDULER_HPP
@@ -1,16 +1,24 @@
 #ifndef SYNC_DETAIL_SCHEDULER_HPP
 #define SYNC_DETAIL_SCHEDULER_HPP
 
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <future>
-#include <queue>
+#include <array>
+#include <memory>
+#include <vector>
 
 #include "sync/detail/binder.hpp"
+#include "sync/detail/call_stack.hpp"
+#include "sync/detail/epoll_reactor.hpp"
 #include "sync/detail/priority_job.hpp"
 #include "sync/basic_executor.hpp"
+#include "sync/queue_options.hpp"
+#include "sync/scheduling_policy.hpp"
 
 
 SYNC_BEGIN
@@ -18,17 +26,71 @@ DETAIL_BEGIN
 
 
 /**
- * @brief Basic task executor with priority ordering. `run()` can be called from multiple threads to execute pending jobs
+ * @brief Basic task executor. `run()` can be called from multiple threads to execute pending jobs
+ * @tparam Policy queueing discipline (see `scheduling_policy.hpp`)
  * @note If allowed to wait, not stopped and no pending jobs -> wait
  * @note If allowed to wait, stopped -> don't accept new jobs, execute all pending jobs
  * @note If not allowed to wait, not stopped -> accept new jobs, execute all pending jobs
  * @note If not allowed to wait, stopped -> don't accept new jobs, don't execute pending jobs
+ * @note Posting to a full queue follows `queue_options::overflow`
+ * @note Jobs about to start after their deadline (dequeued, dispatched inline or run by the caller) are dropped and counted as misses
+ * @note Exceptions escaping a job (detached tasks) go to `queue_options::exception_handler`
+ * @note With `queue_options::reserve()` and a known worker count, lower priority jobs wait while they would use reserved workers
+ * @note While descriptors are watched, `run()` doesn't return on an empty queue: one thread waits in the reactor instead
+ * @note Workers given to `run()` have their own queue for jobs with an affinity key, other workers steal from it when it falls behind
+ * or when its running job posted to it and then stopped making progress (see `_Stall`)
+ * @note A deep queue is dequeued in batches (see `_batch_size()`). Jobs of a batch not started yet still count against
+ * the capacity, and idle threads steal them: a job can wait for a job dequeued after it in the same batch.
  */
+template<class Policy>
 class scheduler : public basic_executor
 {
 private:
-    // Priority queue for tasks
-    std::priority_queue<detail::priority_job> _pendingJobs;
+    // Largest number of jobs taken by `run()` in one critical section
+    static constexpr size_t _max_batch_size = 16;
+
+    // Interval of the checks for a worker blocked by a job it posted to itself
+    static constexpr std::chrono::milliseconds _stall_check_interval{10};
+
+    // Progress of a worker whose running job posted a job to its own queue, the job may wait for it
+    enum class _Stall : uint8_t
+    {
+        none,       // no such job
+        posted,     // not checked yet
+        checked,    // seen by one check, no job started since
+        stalled     // seen by two checks, other workers steal from it
+    };
+
+    // Jobs and wake-up of one worker
+    struct _Worker
+    {
+        Policy jobs;
+        std::condition_variable ready;
+        std::thread::id thread;
+        bool idle = false;
+        _Stall stall = _Stall::none;
+    };
+
+    // Jobs taken by `run()` in one critical section. Jobs not started yet can be stolen by idle threads.
+    struct _Batch
+    {
+        std::vector<detail::priority_job> jobs;
+
+        // Priority band of each job, read by capacity checks while the jobs are moved out
+        std::array<size_t, _max_batch_size> bands = {};
+
+        // Index of the next job to start: the owner claims jobs without lock, idle threads under lock
+        std::atomic_size_t next = 0;
+
+        // Jobs counted in `_batchedJobs`. Lock must be held.
+        size_t counted = 0;
+    };
+
+    // Queue for tasks, ordered by policy
+    Policy _pendingJobs;
+
+    // Jobs allowed on reserved workers (see `queue_options::reserve()`), empty if no workers are reserved
+    Policy _reservedJobs;
 
     // Safety mutex
     mutable std::mutex _pendingJobsMtx;
@@ -36,78 +98,434 @@ private:
     // Condition variable for empty queue wait
     mutable std::condition_variable _pendingJobsCV;
 
+    // Condition variable for full queue wait (producers)
+    std::condition_variable _freeSpaceCV;
+
+    // Capacity limits and overflow behavior
+    queue_options _options;
+
+    // Memory for task state
+    std::pmr::memory_resource* _taskResource = default_slab_resource();
+
+    // Pending jobs count for each priority band
+    std::array<size_t, priority_band_count> _pendingJobsPerBand = {};
+
+    // Number of producers waiting for free space
+    size_t _blockedProducers = 0;
+
+    // Queues of the workers (see `set_worker_count()`), empty if workers are unknown
+    std::vector<_Worker> _workers;
+
+    // Workers waiting for jobs, in the order they went idle
+    std::vector<size_t> _idleWorkers;
+
+    // Jobs pending in the queues of the workers
+    size_t _affineJobCount = 0;
+
+    // Workers with a stall state other than `_Stall::none`
+    size_t _watchedWorkers = 0;
+
+    // An idle thread waits with a timeout to check the watched workers
+    bool _stallWatcher = false;
+
     // Finished tasks counter
     std::atomic_size_t _jobsDone = 0;
 
+    // Posts refused because of a full queue
+    std::atomic_size_t _rejectedPosts = 0;
+
+    // Posts that had to wait for free space
+    std::atomic_size_t _blockedPosts = 0;
+
+    // Jobs with an affinity key executed by a worker other than the preferred one
+    std::atomic_size_t _stolenJobs = 0;
+
+    // Jobs dropped after their deadline, for each priority band
+    std::array<std::atomic_size_t, priority_band_count> _deadlineMisses = {};
+
+    // Number of threads executing `run()`, used for worker reservation (0 if unknown)
+    size_t _workerCount = 0;
+
+    // Workers executing jobs from `_reservedJobs` and from `_pendingJobs`
+    size_t _runningReservedJobs = 0;
+    size_t _runningOtherJobs    = 0;
+
+    // Number of threads executing `run()`
+    std::atomic_size_t _runningThreads = 0;
+
+    // Set while stopped and not allowed to wait, checked between the jobs of a batch without the lock
+    std::atomic_bool _discardPending = false;
+
+    // Batches of the threads executing `run()`
+    std::vector<_Batch*> _batches;
+
+    // Jobs of the batches counted against the capacity: the jobs not started yet, and those started since the batch
+    // was taken until its thread takes the lock again
+    size_t _batchedJobs = 0;
+
     // Flag used for stop state
     bool _stop = false;
 
     // Flag used to allow waiting for jobs
     bool _wait = false;
 
+    // A thread is waiting in (or about to enter) the reactor
+    bool _reactorPolling = false;
+
+#ifdef SYNC_HAS_EPOLL
+    // Jobs executed between reactor polls while the queue is busy
+    static constexpr size_t _reactor_poll_interval = 64;
+
+    // Descriptor readiness, created by the first `watch()`
+    std::unique_ptr<epoll_reactor> _reactor;
+
+    // Jobs taken from the reactor, used only by the polling thread
+    std::vector<detail::priority_job> _readyJobs;
+
+    // Jobs popped since the last reactor poll
+    size_t _jobsSincePoll = 0;
+#endif  // SYNC_HAS_EPOLL
+
+public:
+
+    // Value given to `run()` by threads that are not workers
+    static constexpr size_t no_worker = SIZE_MAX;
+
 public:
 
     scheduler() = default;
 
-    SYNC_DECL ~scheduler() override;
+    /**
+     * @brief Construct scheduler with capacity limits
+     */
+    explicit scheduler(const queue_options& options);
+
+    ~scheduler() override;
 
 public:
 
     /**
      * @brief Used internally by `sync::post()` to submit tasks
+     * @throw `std::system_error` if the queue is full and the job cannot be accepted
      */
-    SYNC_DECL void post(detail::priority_job&& job) override;
+    void post(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::try_post()` to submit tasks without blocking
+     * @return `true` if the job was accepted, `false` if stopped or full (job is left untouched)
+     */
+    bool try_post(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::defer()` to submit continuations
+     * @note Called from a thread running this scheduler, the job runs on the same thread after the current job.
+     * Otherwise same as `post()`.
+     */
+    void defer(detail::priority_job&& job) override;
+
+    /**
+     * @brief Used internally by `sync::dispatch()` to submit tasks
+     * @note Called from a thread running this scheduler, the job runs immediately (up to `call_stack::max_dispatch_depth`
+     * nested calls). Otherwise same as `post()`.
+     */
+    void dispatch(detail::priority_job&& job) override;
 
     /**
      * @brief Returns `true` if the executor is stopped, `false` otherwise.
      */
-    SYNC_DECL bool stopped() const override;
+    bool stopped() const override;
+
+    /**
+     * @brief Returns `true` if the calling thread is executing `run()` of this scheduler
+     */
+    bool running_in_this_thread() const override;
+
+    /**
+     * @brief Used internally by `sync::post()` to allocate task state
+     */
+    std::pmr::memory_resource* get_memory_resource() const override;
+
+    /**
+     * @brief Give an exception from a task of this scheduler to `queue_options::exception_handler`, if set
+     */
+    void report_exception(std::exception_ptr error) override;
 
     /**
      * @brief Return the number of tasks finished (even if they throw)
      */
-    SYNC_DECL size_t jobs_done() const;
+    size_t jobs_done() const;
+
+    /**
+     * @brief Return the number of posts refused because of a full queue
+     */
+    size_t rejected_posts() const;
+
+    /**
+     * @brief Return the number of posts that waited for free space
+     */
+    size_t blocked_posts() const;
+
+    /**
+     * @brief Return the number of jobs with an affinity key executed by a worker other than the preferred one
+     */
+    size_t stolen_jobs() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline (all priorities)
+     */
+    size_t deadline_misses() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline in the band of `prio`
+     */
+    size_t deadline_misses(priority prio) const;
 
     /**
      * @brief Stop the executor. Pending jobs finish before return if `allow_wait()` was called.
      * Running jobs will continue.
      */
-    SYNC_DECL void stop();
+    void stop();
 
     /**
      * @brief Allow new calls for `run()`
      */
-    SYNC_DECL void restart();
+    void restart();
 
     /**
      * @brief Returns `true` if the executor can wait for new jobs if none pending, `false` otherwise.
      */
-    SYNC_DECL bool allowed_to_wait() const;
+    bool allowed_to_wait() const;
 
     /**
      * @brief Threads executing `run()` are allowed to wait for new jobs if not stopped
      * @note If stopped, the scheduler will finish pending jobs first.
      */
-    SYNC_DECL void allow_wait();
+    void allow_wait();
 
     /**
      * @brief Threads executing `run()` exit if stopped or no jobs left
      */
-    SYNC_DECL void forbid_wait();
+    void forbid_wait();
 
     /**
      * @brief Start executing pending jobs
+     * @param worker index in [0, `set_worker_count()`) of the calling thread, it also runs the jobs
+     * with an affinity key mapped to this index
      * @note Can be started from multiple threads
      */
-    SYNC_DECL void run();
+    void run(size_t worker = no_worker);
+
+    /**
+     * @brief Set the number of threads executing `run()`, enables `queue_options::reserved_workers` and
+     * the worker queues used by `sync::affinity`. Called before the threads start.
+     */
+    void set_worker_count(size_t count);
+
+#ifdef SYNC_HAS_EPOLL
+    /**
+     * @brief Call `handler` (as a job of priority `prio`) each time `fd` is ready for `events`, until `unwatch()`
+     * @throw `std::system_error` if `fd` is invalid or already watched
+     */
+    void watch(int fd, io_event events, priority prio, std::function<void(io_event)>&& handler);
+
+    /**
+     * @brief Stop watching `fd`. Must be called before closing it.
+     * @return `false` if `fd` was not watched
+     */
+    bool unwatch(int fd);
+#endif  // SYNC_HAS_EPOLL
+
+private:
+
+    // Kind of job executed by a worker, for reservation accounting
+    enum class _Slot : uint8_t
+    {
+        none,
+        reserved,
+        other
+    };
+
+    // Counts the threads executing `run()`
+    struct _RunningThread
+    {
+        std::atomic_size_t& count;
+
+        explicit _RunningThread(std::atomic_size_t& counter) : count(counter) { ++count; }
+        ~_RunningThread() { --count; }
+    };
+
+    /**
+     * @brief Returns `true` if no jobs are pending. Lock must be held.
+     */
+    bool _empty() const;
+
+    /**
+     * @brief Returns `true` if workers are reserved
+     */
+    bool _reservation_enabled() const;
+
+    /**
+     * @brief Returns `true` if a pending job can start now on `worker`. Lock must be held.
+     */
+    bool _has_runnable_job(size_t worker) const;
+
+    /**
+     * @brief Returns `true` if a job below the reserved priority can start without using reserved workers. Lock must be held.
+     */
+    bool _can_start_other_job() const;
+
+    /**
+     * @brief Number of jobs `run()` takes at once: a share of the queue that leaves most of it to the other threads.
+     * Half of the own queue of `worker`. One job at a time if workers are reserved, the queue is shallow
+     * or the job is stolen. Lock must be held.
+     */
+    size_t _batch_size(size_t worker) const;
+
+    /**
+     * @brief Take the jobs for the next run of `batch`: the first one is claimed, the others can be stolen. Lock must be held.
+     */
+    void _take_batch(_Batch& batch, _Slot& slot, size_t worker);
+
+    /**
+     * @brief Move to `batch` a job not started yet from the batch of a busy thread. Lock must be held.
+     * @return `false` if every batch is started
+     */
+    bool _steal_batched_job(_Batch& batch);
+
+    /**
+     * @brief Clear a finished batch and stop counting it against the capacity. Lock must be held.
+     */
+    void _release_batch(_Batch& batch);
+
+    /**
+     * @brief Queue again the jobs of `batch` not started yet, from `first` (claimed by the owner). Lock must be held.
+     * @note The jobs were counted against the capacity, queueing them doesn't exceed it
+     */
+    void _give_back(_Batch& batch, size_t first);
+
+    /**
+     * @brief Stop counting `count` batched jobs against the capacity, wake the threads waiting for it. Lock must be held.
+     */
+    void _uncount_batched(size_t count);
+
+    /**
+     * @brief Unregister the batch of a thread leaving `run()`. Lock must be held.
+     */
+    void _leave(_Batch& batch);
+
+    /**
+     * @brief Refresh `_discardPending` after a change of `_stop` or `_wait`. Lock must be held.
+     */
+    void _update_discard_pending();
+
+    /**
+     * @brief Give back the worker slot taken by `_pop()`. Lock must be held.
+     */
+    void _release_slot(_Slot& slot);
+
+    /**
+     * @brief Check capacity limits for a new job, jobs of batches not started yet included. Lock must be held.
+     */
+    bool _has_space_for(const detail::priority_job& job) const;
+
+    /**
+     * @brief Insert job and wake a worker. Lock must be held.
+     */
+    void _push(detail::priority_job&& job);
+
+    /**
+     * @brief Remove the next runnable job and wake blocked producers. Lock must be held.
+     * Reserved jobs first, then the own queue of `worker`, the shared queue and the queue of a worker that falls behind.
+     * @param slot set to the worker slot taken by the job
+     */
+    detail::priority_job _pop(_Slot& slot, size_t worker);
+
+    /**
+     * @brief Index of the worker preferred for an affinity key. Workers must be known.
+     */
+    size_t _worker_of(size_t key) const;
+
+    /**
+     * @brief Worker, other than `worker`, with enough jobs waiting to allow stealing. `no_worker` if none. Lock must be held.
+     */
+    size_t _find_victim(size_t worker) const;
+
+    /**
+     * @brief Advance the stall state of the watched workers, none started a job since the previous check. Lock must be held.
+     */
+    void _check_stalls();
+
+    /**
+     * @brief Stop watching `worker`, it starts a job or goes idle. Lock must be held.
+     */
+    void _clear_stall(size_t worker);
+
+    /**
+     * @brief Wait for a wake-up, on the own condition variable of `worker` if any. Lock must be held.
+     * @param timed wait at most `_stall_check_interval`
+     * @return `false` on timeout
+     */
+    bool _wait_for_work(std::unique_lock<std::mutex>& lock, size_t worker, bool timed);
+
+    /**
+     * @brief Wake `worker` if it waits. Lock must be held.
+     */
+    void _wake_worker(size_t worker);
+
+    /**
+     * @brief Wake one waiting thread: an idle worker with jobs of its own, else the longest idle one. Lock must be held.
+     */
+    void _wake_one();
+
+    /**
+     * @brief Wake all waiting threads. Lock must be held.
+     */
+    void _wake_all();
+
+    /**
+     * @brief Run a job, report escaping exceptions and count it
+     */
+    void _execute(const detail::priority_job& job);
+
+    /**
+     * @brief Check the deadline of a job about to start. Count and report the miss if expired.
+     * @return `true` if the job can still run
+     */
+    bool _meets_deadline(const detail::priority_job& job);
+
+    /**
+     * @brief Returns `true` if descriptors are watched. Lock must be held.
+     */
+    bool _reactor_has_work() const;
+
+    /**
+     * @brief Wait (unlocked) for ready descriptors and queue their handlers. Lock must be held.
+     * @param timeoutMs -1 to wait until ready or interrupted, 0 to check without waiting
+     */
+    void _poll_reactor(std::unique_lock<std::mutex>& lock, int timeoutMs);
+
+    /**
+     * @brief Wake the thread waiting in the reactor, if any. Lock must be held.
+     */
+    void _interrupt_reactor();
 };  // END scheduler
 
 
+#ifdef SYNC_SEPARATE_COMPILATION
+// Built once in src/sync.cpp
+extern template class scheduler<priority_policy>;
+extern template class scheduler<fifo_policy>;
+extern template class scheduler<lifo_policy>;
+extern template class scheduler<edf_policy>;
+#endif  // SYNC_SEPARATE_COMPILATION
+
+
 DETAIL_END
 SYNC_END
 
-#ifdef SYNC_HEADER_ONLY
-#   include "sync/detail/impl/scheduler.ipp"
-#endif  // SYNC_HEADER_ONLY
+#include "sync/detail/impl/scheduler.ipp"
+
+// Lock-free specialization for `basic_ring_policy`
+#include "sync/detail/ring_scheduler.hpp"
 
 #endif  // SYNC_DETAIL_SCHEDULER_HPP
@@ -0,0 +1,208 @@
+#ifndef SYNC_DETAIL_SLAB_POOL_HPP
+#define SYNC_DETAIL_SLAB_POOL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "sync/detail/core.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief Free block, the link is stored in the block memory
+ */
+struct slab_block
+{
+    slab_block* next;
+};  // END slab_block
+
+
+class slab_cache;
+
+
+/**
+ * @brief Process wide pool of small fixed size blocks with a cache for each thread
+ * @note Blocks are carved from chunks aligned to `chunk_size`. The chunk header stores the owning cache,
+ * so any thread can find the owner of a block. Blocks freed by other threads return to the owner in batches.
+ * @note Chunks are kept for reuse and never released to the system.
+ */
+class slab_pool
+{
+private:
+    // Abandons the cache of a thread when it exits
+    struct _ThreadGuard
+    {
+        SYNC_DECL ~_ThreadGuard();
+    };
+
+    // Caches of exited threads
+    struct _AbandonedList
+    {
+        std::mutex mtx;
+        slab_cache* head = nullptr;
+    };
+
+public:
+    // Smallest block, also the alignment of every block
+    static constexpr size_t min_block_size      = 16;
+
+    // Largest block served by the pool
+    static constexpr size_t max_block_size      = 512;
+
+    // Number of block sizes (powers of 2 from min to max)
+    static constexpr size_t size_class_count    = 6;
+
+    // Memory carved at once for a size class
+    static constexpr size_t chunk_size          = 64 * 1024;
+
+    // Number of blocks collected before returning them to their owner thread
+    static constexpr size_t batch_size          = 32;
+
+public:
+
+    /**
+     * @brief Returns `true` if the pool can serve this request
+     */
+    static constexpr bool is_pooled(size_t bytes, size_t alignment) noexcept
+    {
+        return bytes <= max_block_size && alignment <= min_block_size;
+    }
+
+    /**
+     * @brief Get a block from the cache of the calling thread
+     * @note `bytes` must satisfy `is_pooled()`
+     */
+    SYNC_DECL static void* allocate(size_t bytes);
+
+    /**
+     * @brief Return a block obtained with `allocate()` with the same `bytes`
+     */
+    SYNC_DECL static void deallocate(void* ptr, size_t bytes) noexcept;
+
+    /**
+     * @brief Index of the size class for `bytes`
+     */
+    static constexpr size_t size_class(size_t bytes) noexcept
+    {
+        size_t index = 0;
+
+        for (size_t blockSize = min_block_size; blockSize < bytes; blockSize <<= 1)
+            ++index;
+
+        return index;
+    }
+
+    /**
+     * @brief Size of the blocks in a size class
+     */
+    static constexpr size_t block_size(size_t sizeClass) noexcept
+    {
+        return min_block_size << sizeClass;
+    }
+
+private:
+
+    /**
+     * @brief Cache of the calling thread, `nullptr` if none is attached
+     */
+    SYNC_DECL static slab_cache*& _thread_cache() noexcept;
+
+    /**
+     * @brief Set during thread exit, after the cache was abandoned
+     */
+    SYNC_DECL static bool& _thread_exiting() noexcept;
+
+    /**
+     * @brief Cache of the calling thread, attached on first use. `nullptr` during thread exit.
+     */
+    SYNC_DECL static slab_cache* _local_cache() noexcept;
+
+    /**
+     * @brief Process wide list of abandoned caches
+     */
+    SYNC_DECL static _AbandonedList& _abandoned() noexcept;
+
+    /**
+     * @brief Take an abandoned cache or create a new one. `nullptr` if out of memory.
+     */
+    SYNC_DECL static slab_cache* _adopt() noexcept;
+
+    /**
+     * @brief Make the cache available to other threads
+     */
+    SYNC_DECL static void _abandon(slab_cache* cache) noexcept;
+};  // END slab_pool
+
+
+/**
+ * @brief Blocks owned by one thread (or abandoned and waiting for adoption)
+ */
+class slab_cache
+{
+private:
+    // Blocks of another cache collected by this thread
+    struct _Batch
+    {
+        slab_cache* owner   = nullptr;
+        slab_block* head    = nullptr;
+        slab_block* tail    = nullptr;
+        size_t count        = 0;
+    };
+
+    // Blocks ready for reuse, touched only by the owner thread
+    std::array<slab_block*, slab_pool::size_class_count> _freeBlocks = {};
+
+    // Blocks returned by other threads
+    std::array<std::atomic<slab_block*>, slab_pool::size_class_count> _remoteBlocks = {};
+
+    // Uncarved memory of the current chunk
+    std::array<char*, slab_pool::size_class_count> _carveBegin  = {};
+    std::array<char*, slab_pool::size_class_count> _carveEnd    = {};
+
+    // Blocks of other caches waiting to be returned
+    std::array<_Batch, slab_pool::size_class_count> _outgoing = {};
+
+public:
+
+    // Link used while the cache is abandoned
+    slab_cache* next_abandoned = nullptr;
+
+public:
+
+    SYNC_DECL void* allocate(size_t sizeClass);
+    SYNC_DECL void deallocate(void* ptr, size_t sizeClass) noexcept;
+
+    /**
+     * @brief Return all collected blocks to their owners
+     */
+    SYNC_DECL void flush() noexcept;
+
+    /**
+     * @brief Called by other threads to give back a list of blocks
+     */
+    SYNC_DECL void push_remote(size_t sizeClass, slab_block* head, slab_block* tail) noexcept;
+
+    /**
+     * @brief Find the cache that carved the block
+     */
+    SYNC_DECL static slab_cache* owner_of(void* ptr) noexcept;
+
+private:
+    SYNC_DECL void* _carve(size_t sizeClass);
+    SYNC_DECL void _flush(size_t sizeClass) noexcept;
+};  // END slab_cache
+
+
+DETAIL_END
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/slab_pool.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_DETAIL_SLAB_POOL_HPP
@@ -0,0 +1,109 @@
+#ifndef SYNC_DETAIL_SPSC_RING_HPP
+#define SYNC_DETAIL_SPSC_RING_HPP
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "sync/detail/core.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+
+/**
+ * @brief Bounded lock-free single-producer single-consumer queue.
+ * Each side caches the position of the other one and reloads it only when the ring looks full (or empty).
+ * @tparam T nothrow movable value type
+ * @note At most one thread pushes and one thread pops at a time
+ * @note Capacity is rounded up to a power of 2
+ */
+template<class T>
+class spsc_ring
+{
+private:
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                    "spsc_ring requires nothrow move operations");
+
+    struct _Slot
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Ring storage
+    std::unique_ptr<_Slot[]> _slots;
+
+    // Capacity - 1
+    size_t _mask;
+
+    // Next position to read, written by the consumer
+    alignas(cache_line_size) std::atomic_size_t _head = 0;
+
+    // Last `_tail` seen by the consumer
+    size_t _cachedTail = 0;
+
+    // Next position to write, written by the producer
+    alignas(cache_line_size) std::atomic_size_t _tail = 0;
+
+    // Last `_head` seen by the producer
+    size_t _cachedHead = 0;
+
+public:
+
+    /**
+     * @param capacity minimum number of values held, at least 2
+     */
+    explicit spsc_ring(size_t capacity);
+
+    ~spsc_ring();
+
+    spsc_ring(const spsc_ring&)             = delete;
+    spsc_ring& operator=(const spsc_ring&)  = delete;
+
+public:
+
+    /**
+     * @brief Move `value` in the ring (producer only)
+     * @return `false` if full (`value` is left untouched)
+     */
+    bool try_push(T&& value) noexcept;
+
+    /**
+     * @brief Move the oldest value to `value` (consumer only)
+     * @return `false` if empty
+     */
+    bool try_pop(T& value) noexcept;
+
+    /**
+     * @brief Move up to `count` values starting at `first` in the ring, published at once (producer only)
+     * @return Number of values pushed (the rest are left untouched)
+     */
+    template<class InputIt>
+    size_t try_push_batch(InputIt first, size_t count) noexcept;
+
+    /**
+     * @brief Move up to `maxCount` values to `out`, released at once (consumer only)
+     * @return Number of values popped
+     */
+    template<class OutputIt>
+    size_t try_pop_batch(OutputIt out, size_t maxCount);
+
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Number of values, exact only if no push or pop is in progress
+     */
+    size_t size_approx() const noexcept;
+
+private:
+    T* _value_at(size_t pos) noexcept;
+};  // END spsc_ring
+
+
+DETAIL_END
+SYNC_END
+
+#include "sync/detail/impl/spsc_ring.ipp"
+
+#endif  // SYNC_DETAIL_SPSC_RING_HPP
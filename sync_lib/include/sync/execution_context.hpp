@@ -1,6 +1,8 @@
 #ifndef SYNC_EXECUTION_CONTEXT_HPP
 #define SYNC_EXECUTION_CONTEXT_HPP
 
+#include <optional>
+
 #include "sync/basic_executor.hpp"
 
 
@@ -22,7 +24,7 @@ public:
  * @param func Task to execute
  * @param args Arguments for task execution
  * @return A `std::future` of the task result
- * @throw `std::system_error` if the context executor is stopped
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
  */
 template<class Functor, class... Args>
 std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, Functor&& func, Args&&... args);
@@ -35,6 +37,149 @@ template<class Functor, class... Args>
 std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, Functor&& func, Args&&... args);
 
 
+/**
+ * @brief Submit tasks with an absolute deadline to an execution context
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling
+ * @param deadline Time after which the task is dropped if not started
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @return A `std::future` of the task result. A dropped task leaves the future with `std::future_errc::broken_promise`.
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
+ * @note The deadline is used for ordering by `sync::edf_policy` and `sync::priority_policy`
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, std::chrono::steady_clock::time_point deadline, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, std::chrono::steady_clock::time_point deadline, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit tasks that should run on the same worker as the other tasks with the same key.
+ * A `thread_pool` keeps a queue for each worker and maps the key to one of them; idle workers steal
+ * from a queue that falls behind (see `queue_options::affinity_steal_threshold`). Other contexts ignore the key.
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling
+ * @param key Affinity key (shard, connection, ...)
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @return A `std::future` of the task result
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
+ * @note Tasks at or above `queue_options::reserved_priority` go to reserved workers instead
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, priority prio, affinity key, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> post(execution_context& context, affinity key, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit tasks to an execution context without blocking
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @return A `std::future` of the task result, or `std::nullopt` if the context executor is stopped or its queue is full
+ */
+template<class Functor, class... Args>
+std::optional<std::future<std::invoke_result_t<Functor, Args...>>> try_post(execution_context& context, priority prio, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+std::optional<std::future<std::invoke_result_t<Functor, Args...>>> try_post(execution_context& context, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit tasks to an execution context, running them immediately if possible.
+ * Called from a task running on the same context, the task runs inline before `dispatch()` returns
+ * (nesting is bounded, deeper calls are queued). Otherwise same as `sync::post()`.
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling (used if queued)
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @return A `std::future` of the task result
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> dispatch(execution_context& context, priority prio, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+std::future<std::invoke_result_t<Functor, Args...>> dispatch(execution_context& context, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit fire-and-forget tasks to an execution context. No promise or future is created.
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
+ * @note Exceptions thrown by the task go to `queue_options::exception_handler` of the context
+ */
+template<class Functor, class... Args>
+void post_detached(execution_context& context, priority prio, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+void post_detached(execution_context& context, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit fire-and-forget tasks with an affinity key (see the `sync::post()` overload with `sync::affinity`)
+ */
+template<class Functor, class... Args>
+void post_detached(execution_context& context, priority prio, affinity key, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+void post_detached(execution_context& context, affinity key, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Submit fire-and-forget continuations to an execution context.
+ * Called from a task running on the same context, the continuation runs on the calling thread right after
+ * that task returns, without going through the queue. Otherwise same as `sync::post_detached()`.
+ * @param context Execution context where the task is executed
+ * @param prio Optional: Priority for scheduling (used if queued)
+ * @param func Task to execute
+ * @param args Arguments for task execution
+ * @throw `std::system_error` if the context executor is stopped or its queue is full (see `sync::overflow_policy`)
+ * @note Exceptions thrown by the task go to `queue_options::exception_handler` of the context
+ */
+template<class Functor, class... Args>
+void defer(execution_context& context, priority prio, Functor&& func, Args&&... args);
+
+
+/**
+ * @brief Overloaded variant with medium priority
+ */
+template<class Functor, class... Args>
+void defer(execution_context& context, Functor&& func, Args&&... args);
+
+
 SYNC_END
 
 #include "sync/detail/impl/execution_context.ipp"
@@ -0,0 +1,49 @@
+#ifndef SYNC_IO_EVENT_HPP
+#define SYNC_IO_EVENT_HPP
+
+#include <cstdint>
+
+#include "sync/detail/core.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief File descriptor readiness flags used by `watch()` of execution contexts
+ * @note `error` and `hangup` are always reported, they don't need to be requested
+ */
+enum class io_event : uint32_t
+{
+    none        = 0,
+    readable    = 1 << 0,
+    writable    = 1 << 1,
+    error       = 1 << 2,
+    hangup      = 1 << 3
+};  // END io_event
+
+
+constexpr io_event operator|(io_event left, io_event right) noexcept
+{
+    return static_cast<io_event>(static_cast<uint32_t>(left) | static_cast<uint32_t>(right));
+}
+
+
+constexpr io_event operator&(io_event left, io_event right) noexcept
+{
+    return static_cast<io_event>(static_cast<uint32_t>(left) & static_cast<uint32_t>(right));
+}
+
+
+/**
+ * @brief Returns `true` if any flag of `flags` is set in `events`
+ */
+constexpr bool has_event(io_event events, io_event flags) noexcept
+{
+    return (events & flags) != io_event::none;
+}
+
+
+SYNC_END
+
+#endif  // SYNC_IO_EVENT_HPP
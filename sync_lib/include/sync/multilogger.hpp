@@ -34,14 +34,24 @@ public:
     template<class StreamType>
     void add(StreamType& ostream);
 
-    void clear();
-    bool empty() const;
-    void write(const char* c, std::streamsize n);
+    SYNC_DECL void clear();
+    SYNC_DECL bool empty() const;
+    SYNC_DECL void write(const char* c, std::streamsize n);
 };  // END multilogger
 
 
+template<class StreamType>
+void multilogger::add(StreamType& ostream)
+{
+    std::lock_guard lock(_mtx);
+    _ostreams.push_back(detail::output_stream(ostream));
+}
+
+
 SYNC_END
 
-#include "sync/detail/impl/multilogger.ipp"
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/multilogger.ipp"
+#endif  // SYNC_HEADER_ONLY
 
 #endif  // SYNC_MULTILOGGER_HPP
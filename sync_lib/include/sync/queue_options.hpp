@@ -0,0 +1,103 @@
+#ifndef SYNC_QUEUE_OPTIONS_HPP
+#define SYNC_QUEUE_OPTIONS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory_resource>
+
+#include "sync/detail/priority_job.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Action taken by `sync::post()` when the pending jobs queue is full
+ */
+enum class overflow_policy : uint8_t
+{
+    block,          // wait for free space, throw if `queue_options::block_timeout` expires
+    reject,         // throw `std::system_error` immediately
+    caller_runs     // execute the task on the calling thread
+};  // END overflow_policy
+
+
+/**
+ * @brief Capacity configuration of the pending jobs queue of an execution context
+ * @note A job is accepted only if both the total capacity and the capacity of its priority band allow it
+ * @note A job with an expired deadline is not executed when dequeued, dispatched inline or run by the caller,
+ * `deadline_miss_handler` is called instead
+ */
+struct queue_options
+{
+    // Value used for no capacity limit
+    static constexpr size_t unbounded = SIZE_MAX;
+
+    // Maximum number of pending jobs (all priorities)
+    size_t capacity = unbounded;
+
+    // Maximum number of pending jobs for each priority band (see `detail::priority_band()`)
+    std::array<size_t, detail::priority_band_count> priority_capacity = {unbounded, unbounded, unbounded, unbounded, unbounded};
+
+    // Action taken by `sync::post()` on a full queue
+    overflow_policy overflow = overflow_policy::reject;
+
+    // Maximum wait time for `overflow_policy::block`
+    std::chrono::milliseconds block_timeout = std::chrono::milliseconds::max();
+
+    // Optional fallback called (on the executing thread) with the priority of each job dropped after its deadline. Must not throw.
+    std::function<void(priority)> deadline_miss_handler;
+
+    // Optional handler called (on the worker thread) with exceptions thrown by detached tasks. Must not throw.
+    // Also called (on the notifying thread) with the error of a `sync::channel` or `sync::async_semaphore` handler
+    // this context refused to resume.
+    // Exceptions are ignored if not set.
+    std::function<void(std::exception_ptr)> exception_handler;
+
+    // Memory for task state (bound arguments, promise shared state). `nullptr` selects `sync::default_slab_resource()`.
+    std::pmr::memory_resource* task_resource = nullptr;
+
+    // Workers of a `thread_pool` kept free for jobs at or above `reserved_priority` (see `reserve()`)
+    size_t reserved_workers = 0;
+
+    // Lowest priority allowed on reserved workers
+    priority reserved_priority = priority::high;
+
+    // Jobs waiting in the queue of a `thread_pool` worker (see `sync::affinity`) before idle workers steal from it.
+    // A job posted by a worker to its own queue is also stolen if that worker starts no job for 10 to 20 ms,
+    // so a job can wait for a job with the same key it posted.
+    size_t affinity_steal_threshold = 2;
+
+    /**
+     * @brief Set the capacity of the band that contains `prio`
+     * @return Reference to this object for chaining
+     */
+    queue_options& limit(priority prio, size_t n) noexcept
+    {
+        priority_capacity[detail::priority_band(prio)] = n;
+        return *this;
+    }
+
+    /**
+     * @brief Keep `workers` threads of a `thread_pool` for jobs of priority `prio` or higher.
+     * Lower priority jobs run only while that many workers stay idle or busy with such jobs,
+     * so a reserved job never waits behind a flood of lower priority work.
+     * Reserved workers are not dedicated threads: any worker takes lower priority work if the reservation still holds.
+     * @note Reserved jobs are dequeued before all others. At least one worker is left for lower priority jobs.
+     * @return Reference to this object for chaining
+     */
+    queue_options& reserve(priority prio, size_t workers) noexcept
+    {
+        reserved_priority   = prio;
+        reserved_workers    = workers;
+        return *this;
+    }
+};  // END queue_options
+
+
+SYNC_END
+
+#endif  // SYNC_QUEUE_OPTIONS_HPP
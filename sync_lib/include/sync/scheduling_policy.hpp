@@ -0,0 +1,143 @@
+#ifndef SYNC_SCHEDULING_POLICY_HPP
+#define SYNC_SCHEDULING_POLICY_HPP
+
+#include <vector>
+
+#include "sync/detail/priority_job.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Queueing discipline where jobs run in submission order
+ * @note No heap and no clock reads. Priorities are only used for capacity accounting.
+ * @note Jobs are kept in a growing ring buffer, steady state push/pop does not allocate.
+ */
+class fifo_policy
+{
+private:
+    std::vector<detail::priority_job> _jobs;    // ring buffer
+    size_t _head = 0;
+    size_t _size = 0;
+
+public:
+
+    SYNC_DECL bool empty() const;
+    SYNC_DECL size_t size() const;
+    SYNC_DECL void push(detail::priority_job&& job);
+    SYNC_DECL detail::priority_job pop();
+
+private:
+    SYNC_DECL void _grow();
+};  // END fifo_policy
+
+
+/**
+ * @brief Queueing discipline where the most recent job runs first
+ * @note Suited for recursive work, the data of the last job is likely still in cache
+ */
+class lifo_policy
+{
+private:
+    std::vector<detail::priority_job> _jobs;
+
+public:
+
+    SYNC_DECL bool empty() const;
+    SYNC_DECL size_t size() const;
+    SYNC_DECL void push(detail::priority_job&& job);
+    SYNC_DECL detail::priority_job pop();
+};  // END lifo_policy
+
+
+/**
+ * @brief Queueing discipline ordered by priority. Priority is raised by one level for each second waited (aging).
+ * Jobs with a deadline are ordered by it if the deadline comes before the job reaches `priority::highest`.
+ * @note Aging is derived from the insertion time, ordering does not read the clock
+ */
+class priority_policy
+{
+private:
+    std::vector<detail::priority_job> _jobs;    // binary heap
+
+public:
+
+    SYNC_DECL bool empty() const;
+    SYNC_DECL size_t size() const;
+    SYNC_DECL void push(detail::priority_job&& job);
+    SYNC_DECL detail::priority_job pop();
+
+private:
+    /**
+     * @brief Heap ordering. Insertion time plus one second for each priority level gives
+     * the moment when the job reaches `priority::highest`. The urgency of a job is the earliest
+     * between this moment and its deadline - earlier means more urgent.
+     */
+    SYNC_DECL static bool _less_urgent(const detail::priority_job& left, const detail::priority_job& right);
+};  // END priority_policy
+
+
+/**
+ * @brief Queueing discipline ordered by deadline (earliest deadline first)
+ * @note Jobs without deadline run after all jobs with deadline, in submission order
+ */
+class edf_policy
+{
+private:
+    struct _Entry
+    {
+        detail::priority_job job;
+        size_t sequence;
+    };
+
+    std::vector<_Entry> _jobs;  // binary heap
+    size_t _sequence = 0;
+
+public:
+
+    SYNC_DECL bool empty() const;
+    SYNC_DECL size_t size() const;
+    SYNC_DECL void push(detail::priority_job&& job);
+    SYNC_DECL detail::priority_job pop();
+
+private:
+    SYNC_DECL static bool _less_urgent(const _Entry& left, const _Entry& right);
+};  // END edf_policy
+
+
+/**
+ * @brief Lock-free backend: jobs go to bounded rings with a sequence number for each slot (see `detail::mpmc_ring`).
+ * Posting and dequeueing take no lock, workers park only when every ring is empty.
+ * @tparam PerPriority one ring for each priority band, higher bands first. Otherwise a single ring in submission order.
+ * @note Ring capacity is `queue_options::capacity` (and `priority_capacity` of the band), rounded up to a power of 2.
+ * `default_capacity` if unbounded, so the default `overflow_policy::reject` throws once that many jobs wait.
+ * The capacities set in `queue_options` are still exact, over all rings, as with the other policies.
+ * @note No aging and no deadline ordering. Affinity keys and descriptor watches are not supported, reserved workers are
+ * refused with `std::invalid_argument`.
+ */
+template<bool PerPriority>
+struct basic_ring_policy
+{
+    // Capacity of a ring without limit in `queue_options`
+    static constexpr size_t default_capacity = 1024;
+
+    // Number of rings
+    static constexpr size_t ring_count = PerPriority ? detail::priority_band_count : 1;
+};  // END basic_ring_policy
+
+
+// One ring for each priority band
+using ring_policy       = basic_ring_policy<true>;
+
+// Single ring, submission order
+using fifo_ring_policy  = basic_ring_policy<false>;
+
+
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/scheduling_policy.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_SCHEDULING_POLICY_HPP
@@ -0,0 +1,39 @@
+#ifndef SYNC_SLAB_RESOURCE_HPP
+#define SYNC_SLAB_RESOURCE_HPP
+
+#include <memory_resource>
+
+#include "sync/detail/slab_pool.hpp"
+
+
+SYNC_BEGIN
+
+
+/**
+ * @brief Memory resource backed by per-thread free lists of small blocks.
+ * Used by execution contexts for task state, so steady state posting does not reach the global allocator.
+ * @note Requests larger than `detail::slab_pool::max_block_size` or over-aligned go to `std::pmr::new_delete_resource()`
+ * @note All instances share the same process wide pool and compare equal
+ */
+class slab_resource : public std::pmr::memory_resource
+{
+protected:
+    SYNC_DECL void* do_allocate(size_t bytes, size_t alignment) override;
+    SYNC_DECL void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    SYNC_DECL bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};  // END slab_resource
+
+
+/**
+ * @brief Return a pointer to the process wide `slab_resource`
+ */
+SYNC_DECL slab_resource* default_slab_resource() noexcept;
+
+
+SYNC_END
+
+#ifdef SYNC_HEADER_ONLY
+#   include "sync/detail/impl/slab_resource.ipp"
+#endif  // SYNC_HEADER_ONLY
+
+#endif  // SYNC_SLAB_RESOURCE_HPP
@@ -9,54 +9,143 @@
 SYNC_BEGIN
 
 
-class task_context : public execution_context
+/**
+ * @brief Execution context where posted functions run on the threads calling `run()`.
+ * @tparam Policy queueing discipline (see `scheduling_policy.hpp`)
+ */
+template<class Policy>
+class basic_task_context : public execution_context
 {
 private:
 
     // Basic executor for tasks
-    detail::scheduler _scheduler;
+    detail::scheduler<Policy> _scheduler;
 
 public:
 
-    SYNC_DECL task_context();
+    basic_task_context();
 
-    SYNC_DECL ~task_context() override;
+    /**
+     * @brief Construct task_context with bounded queue
+     * @param options capacity limits and overflow behavior
+     * @note `overflow_policy::block` waits for a concurrent `run()` to make space
+     * @throw `std::invalid_argument` if `options` reserves workers for a ring policy (see `basic_ring_policy`)
+     */
+    explicit basic_task_context(const queue_options& options);
+
+    ~basic_task_context() override;
 
 public:
 
     /**
      * @brief Return a reference to the executor associated with the pool
      */
-    SYNC_DECL basic_executor& get_executor() override;
+    basic_executor& get_executor() override;
 
     /**
      * @brief Returns `true` if the executor is stopped, `false` otherwise.
      */
-    SYNC_DECL bool stopped() const;
+    bool stopped() const;
+
+    /**
+     * @brief Returns `true` if the calling thread is one executing tasks of this context
+     */
+    bool running_in_this_thread() const;
+
+    /**
+     * @brief Return the number of tasks finished (even if they throw)
+     */
+    size_t jobs_done() const;
+
+    /**
+     * @brief Return the number of posts refused because of a full queue
+     */
+    size_t rejected_posts() const;
+
+    /**
+     * @brief Return the number of posts that waited for free space
+     */
+    size_t blocked_posts() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline (all priorities)
+     */
+    size_t deadline_misses() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline in the band of `prio`
+     */
+    size_t deadline_misses(priority prio) const;
 
     /**
      * @brief Allow new calls for `run()`
      */
-    SYNC_DECL void restart();
+    void restart();
 
     /**
      * @brief Start tasks
+     * @note Returns when no tasks are pending and no descriptors are watched (or when stopped)
      */
-    SYNC_DECL void run();
+    void run();
 
     /**
      * @brief Stop the executor. Pending jobs are no longer available.
      * Running jobs will continue.
      * Subsequent `run()` calls return immediately.
      */
-    SYNC_DECL void stop();
-};  // END task_context
+    void stop();
+
+#ifdef SYNC_HAS_EPOLL
+    /**
+     * @brief Call `handler` on a thread calling `run()` each time `fd` is ready for `events`, until `unwatch()`.
+     * Calls for the same descriptor never overlap; the handler gets the ready flags.
+     * @param prio priority of the handler jobs
+     * @throw `std::system_error` if `fd` is invalid or already watched
+     * @note `run()` waits for watched descriptors instead of returning
+     */
+    void watch(int fd, io_event events, std::function<void(io_event)> handler, priority prio = priority::medium);
+
+    /**
+     * @brief Stop watching `fd`. Must be called before closing it.
+     * @return `false` if `fd` was not watched
+     */
+    bool unwatch(int fd);
+#endif  // SYNC_HAS_EPOLL
+};  // END basic_task_context
+
+
+// Default configuration: priority ordering with aging
+using task_context      = basic_task_context<priority_policy>;
+
+// Submission order, no heap and no clock reads
+using fifo_task_context = basic_task_context<fifo_policy>;
+
+// Most recent job first
+using lifo_task_context = basic_task_context<lifo_policy>;
+
+// Earliest deadline first
+using edf_task_context  = basic_task_context<edf_policy>;
+
+// Lock-free rings, one for each priority band
+using ring_task_context      = basic_task_context<ring_policy>;
+
+// Lock-free ring, submission order
+using fifo_ring_task_context = basic_task_context<fifo_ring_policy>;
+
+
+#ifdef SYNC_SEPARATE_COMPILATION
+// Built once in src/sync.cpp
+extern template class basic_task_context<priority_policy>;
+extern template class basic_task_context<fifo_policy>;
+extern template class basic_task_context<lifo_policy>;
+extern template class basic_task_context<edf_policy>;
+extern template class basic_task_context<ring_policy>;
+extern template class basic_task_context<fifo_ring_policy>;
+#endif  // SYNC_SEPARATE_COMPILATION
 
 
 SYNC_END
 
-#ifdef SYNC_HEADER_ONLY
-#   include "sync/detail/impl/task_context.ipp"
-#endif  // SYNC_HEADER_ONLY
+#include "sync/detail/impl/task_context.ipp"
 
 #endif  // SYNC_TASK_CONTEXT_HPP
@@ -15,13 +15,15 @@ SYNC_BEGIN
  * @brief The thread pool class is an execution context where functions are permitted to run on one of a fixed number of threads.
  * 
  * Use `sync::post()` to submit functions to the pool.
+ * @tparam Policy queueing discipline (see `scheduling_policy.hpp`)
  */
-class thread_pool : public execution_context
+template<class Policy>
+class basic_thread_pool : public execution_context
 {
 private:
 
     // Basic executor for tasks
-    detail::scheduler _scheduler;
+    detail::scheduler<Policy> _scheduler;
 
     // Dynamic container for threads. Also join automatically when destroyed
     std::vector<std::jthread> _threads;
@@ -31,59 +33,142 @@ public:
     /**
      * @brief Construct thread_pool with default number of threads `std::thread::hardware_concurrency()`
      */
-    SYNC_DECL thread_pool()
-        : thread_pool(std::thread::hardware_concurrency()) { /* Empty */ }
+    basic_thread_pool()
+        : basic_thread_pool(std::thread::hardware_concurrency()) { /* Empty */ }
 
     /**
      * @brief Construct thread_pool with specified number of threads
      * @param nthreads number of threads
      */
-    SYNC_DECL thread_pool(size_t nthreads);
+    basic_thread_pool(size_t nthreads);
+
+    /**
+     * @brief Construct thread_pool with specified number of threads and bounded queue
+     * @param nthreads number of threads
+     * @param options capacity limits and overflow behavior
+     * @throw `std::invalid_argument` if `options` reserves workers for a ring policy (see `basic_ring_policy`)
+     */
+    basic_thread_pool(size_t nthreads, const queue_options& options);
 
     /**
      * @brief Calls `join()` before destroying the object
      */
-    SYNC_DECL ~thread_pool() override;
+    ~basic_thread_pool() override;
 
 public:
 
     /**
      * @brief Return a reference to the executor associated with the pool
      */
-    SYNC_DECL basic_executor& get_executor() override;
+    basic_executor& get_executor() override;
 
     /**
      * @brief Return the number of running threads
      */
-    SYNC_DECL size_t thread_count() const;
+    size_t thread_count() const;
 
     /**
      * @brief Return the number of tasks finished (even if they throw)
      */
-    SYNC_DECL size_t jobs_done() const;
+    size_t jobs_done() const;
+
+    /**
+     * @brief Return the number of posts refused because of a full queue
+     */
+    size_t rejected_posts() const;
+
+    /**
+     * @brief Return the number of posts that waited for free space
+     */
+    size_t blocked_posts() const;
+
+    /**
+     * @brief Return the number of tasks posted with a `sync::affinity` key that ran on another worker than the preferred one
+     */
+    size_t stolen_jobs() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline (all priorities)
+     */
+    size_t deadline_misses() const;
+
+    /**
+     * @brief Return the number of jobs dropped after their deadline in the band of `prio`
+     */
+    size_t deadline_misses(priority prio) const;
 
     /**
      * @brief Returns `true` if the executor is stopped, `false` otherwise.
      */
-    SYNC_DECL bool stopped() const;
+    bool stopped() const;
+
+    /**
+     * @brief Returns `true` if the calling thread is one executing tasks of this context
+     */
+    bool running_in_this_thread() const;
 
     /**
      * @brief Stop the executor (non-blocking). Pending jobs are no longer available.
      * Running jobs will continue.
      */
-    SYNC_DECL void stop();
+    void stop();
 
     /**
      * @brief Block until all pending jobs are finished, then join threads.
      */
-    SYNC_DECL void join();
-};  // END thread_pool
+    void join();
+
+#ifdef SYNC_HAS_EPOLL
+    /**
+     * @brief Call `handler` on a pool thread each time `fd` is ready for `events`, until `unwatch()`.
+     * Calls for the same descriptor never overlap; the handler gets the ready flags.
+     * @param prio priority of the handler jobs
+     * @throw `std::system_error` if `fd` is invalid or already watched
+     * @note An idle pool thread waits for the descriptors
+     */
+    void watch(int fd, io_event events, std::function<void(io_event)> handler, priority prio = priority::medium);
+
+    /**
+     * @brief Stop watching `fd`. Must be called before closing it.
+     * @return `false` if `fd` was not watched
+     */
+    bool unwatch(int fd);
+#endif  // SYNC_HAS_EPOLL
+};  // END basic_thread_pool
+
+
+// Default configuration: priority ordering with aging
+using thread_pool      = basic_thread_pool<priority_policy>;
+
+// Submission order, no heap and no clock reads
+using fifo_thread_pool = basic_thread_pool<fifo_policy>;
+
+// Most recent job first
+using lifo_thread_pool = basic_thread_pool<lifo_policy>;
+
+// Earliest deadline first
+using edf_thread_pool  = basic_thread_pool<edf_policy>;
+
+// Lock-free rings, one for each priority band
+using ring_thread_pool      = basic_thread_pool<ring_policy>;
+
+// Lock-free ring, submission order
+using fifo_ring_thread_pool = basic_thread_pool<fifo_ring_policy>;
+
+
+#ifdef SYNC_SEPARATE_COMPILATION
+// Default policies are instantiated in the compiled library (see src/sync.cpp)
+extern template class basic_thread_pool<priority_policy>;
+extern template class basic_thread_pool<fifo_policy>;
+extern template class basic_thread_pool<lifo_policy>;
+extern template class basic_thread_pool<edf_policy>;
+extern template class basic_thread_pool<ring_policy>;
+extern template class basic_thread_pool<fifo_ring_policy>;
+#endif  // SYNC_SEPARATE_COMPILATION
 
 
 SYNC_END
 
-#ifdef SYNC_HEADER_ONLY
-#   include "sync/detail/impl/thread_pool.ipp"
-#endif  // SYNC_HEADER_ONLY
+#include "sync/detail/impl/thread_pool.ipp"
 
 #endif  // SYNC_THREAD_POOL_HPP
@@ -0,0 +1,49 @@
+// Non-template code of the library and the default policy instantiations.
+// Built by the `Sync_Library_Compiled` target, with SYNC_SEPARATE_COMPILATION defined.
+
+#ifndef SYNC_SEPARATE_COMPILATION
+#   error "sync.cpp must be built with SYNC_SEPARATE_COMPILATION defined"
+#endif  // SYNC_SEPARATE_COMPILATION
+
+#include "sync/detail/impl/async_semaphore.ipp"
+#include "sync/detail/impl/call_stack.ipp"
+#include "sync/detail/impl/epoll_reactor.ipp"
+#include "sync/detail/impl/job_function.ipp"
+#include "sync/detail/impl/multilogger.ipp"
+#include "sync/detail/impl/output_stream.ipp"
+#include "sync/detail/impl/priority_job.ipp"
+#include "sync/detail/impl/scheduling_policy.ipp"
+#include "sync/detail/impl/slab_pool.ipp"
+#include "sync/detail/impl/slab_resource.ipp"
+
+#include "sync/task_context.hpp"
+#include "sync/thread_pool.hpp"
+
+
+SYNC_BEGIN
+DETAIL_BEGIN
+
+template class scheduler<priority_policy>;
+template class scheduler<fifo_policy>;
+template class scheduler<lifo_policy>;
+template class scheduler<edf_policy>;
+template class scheduler<ring_policy>;
+template class scheduler<fifo_ring_policy>;
+
+DETAIL_END
+
+template class basic_thread_pool<priority_policy>;
+template class basic_thread_pool<fifo_policy>;
+template class basic_thread_pool<lifo_policy>;
+template class basic_thread_pool<edf_policy>;
+template class basic_thread_pool<ring_policy>;
+template class basic_thread_pool<fifo_ring_policy>;
+
+template class basic_task_context<priority_policy>;
+template class basic_task_context<fifo_policy>;
+template class basic_task_context<lifo_policy>;
+template class basic_task_context<edf_policy>;
+template class basic_task_context<ring_policy>;
+template class basic_task_context<fifo_ring_policy>;
+
+SYNC_END
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include "sync/async_mutex.hpp"
+#include "sync/task_context.hpp"
+#include "sync/thread_pool.hpp"
+
+
+TEST(SyncAsyncSemaphore_Operations, try_acquire)
+{
+    sync::async_semaphore semaphore(2);
+
+    EXPECT_TRUE(semaphore.try_acquire());
+    EXPECT_TRUE(semaphore.try_acquire());
+    EXPECT_FALSE(semaphore.try_acquire());
+    EXPECT_EQ(semaphore.available(), 0);
+
+    semaphore.release(2);
+    EXPECT_EQ(semaphore.available(), 2);
+}
+
+
+TEST(SyncAsyncSemaphore_Operations, waiters_served_in_order)
+{
+    std::vector<int> execution_order;
+    sync::task_context tc;
+    sync::async_semaphore semaphore(1);
+
+    semaphore.async_acquire(tc, [&]() { execution_order.push_back(1); });   // free permit, posted
+    semaphore.async_acquire(tc, [&]() { execution_order.push_back(2); semaphore.release(); });
+    semaphore.async_acquire(tc, [&]() { execution_order.push_back(3); semaphore.release(); });
+
+    tc.run();
+    EXPECT_EQ(execution_order, std::vector<int>({1}));     // others wait for the permit
+
+    semaphore.release();    // hands the permit to the second handler, it passes it on
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(semaphore.available(), 1);
+}
+
+
+TEST(SyncAsyncSemaphore_Operations, limits_concurrency)
+{
+    constexpr int task_count = 200;
+
+    sync::thread_pool tp(4);
+    sync::async_semaphore semaphore(2);
+
+    std::atomic_int active      = 0;
+    std::atomic_int maxActive   = 0;
+    std::atomic_int done        = 0;
+    std::promise<void> finished;
+
+    for (int i = 0; i < task_count; ++i)
+        semaphore.async_acquire(tp, [&]() {
+            int now = ++active;
+            int seen = maxActive;
+
+            while (now > seen && !maxActive.compare_exchange_weak(seen, now)) { /* retry */ }
+
+            std::this_thread::yield();
+            --active;
+            semaphore.release();
+
+            if (++done == task_count)
+                finished.set_value();
+        });
+
+    finished.get_future().wait();
+
+    EXPECT_LE(maxActive, 2);
+    EXPECT_EQ(semaphore.available(), 2);
+}
+
+
+TEST(SyncAsyncSemaphore_Operations, stopped_context)
+{
+    sync::task_context tc;
+    sync::async_semaphore semaphore(1);
+
+    tc.stop();
+
+    EXPECT_THROW(semaphore.async_acquire(tc, []() {}), std::system_error);
+    EXPECT_EQ(semaphore.available(), 1);   // no permit kept
+}
+
+
+TEST(SyncAsyncSemaphore_Operations, inline_on_own_context)
+{
+    sync::task_context tc;
+    sync::async_semaphore semaphore(1);
+    std::vector<int> execution_order;
+
+    sync::post_detached(tc, [&]() {
+        // Free permit and already on the context: no queueing
+        semaphore.async_acquire(tc, [&]() { execution_order.push_back(1); semaphore.release(); });
+        execution_order.push_back(2);
+    });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2}));
+    EXPECT_EQ(semaphore.available(), 1);
+}
+
+
+TEST(SyncAsyncSemaphore_Operations, refused_waiter_reported)
+{
+    std::vector<std::exception_ptr> errors;
+    sync::task_context tc(sync::queue_options{  .capacity = 1,
+                                                .exception_handler = [&](std::exception_ptr error) { errors.push_back(error); }});
+    sync::async_semaphore semaphore(1);
+    bool called = false;
+
+    ASSERT_TRUE(semaphore.try_acquire());
+    semaphore.async_acquire(tc, [&]() { called = true; });
+
+    sync::post_detached(tc, [](){});    // queue is full when the permit is handed over
+    semaphore.release();
+
+    ASSERT_EQ(errors.size(), 1);
+    EXPECT_THROW(std::rethrow_exception(errors[0]), std::system_error);
+    EXPECT_EQ(semaphore.available(), 1);   // the permit is not lost
+
+    tc.run();
+    EXPECT_FALSE(called);
+}
+
+
+TEST(SyncAsyncMutex_Operations, try_lock)
+{
+    sync::async_mutex mutex;
+
+    EXPECT_FALSE(mutex.locked());
+    EXPECT_TRUE(mutex.try_lock());
+    EXPECT_TRUE(mutex.locked());
+    EXPECT_FALSE(mutex.try_lock());
+
+    mutex.unlock();
+    EXPECT_FALSE(mutex.locked());
+}
+
+
+TEST(SyncAsyncMutex_Operations, exclusive_on_pool)
+{
+    constexpr int task_count = 1000;
+
+    sync::thread_pool tp(4);
+    sync::async_mutex mutex;
+
+    int counter = 0;    // guarded by the mutex only
+    std::atomic_int done = 0;
+    std::promise<void> finished;
+
+    for (int i = 0; i < task_count; ++i)
+        mutex.async_lock(tp, [&]() {
+            int value = counter;
+            std::this_thread::yield();
+            counter = value + 1;
+            mutex.unlock();
+
+            if (++done == task_count)
+                finished.set_value();
+        });
+
+    finished.get_future().wait();
+
+    EXPECT_EQ(counter, task_count);
+    EXPECT_FALSE(mutex.locked());
+}
+
+
+TEST(SyncAsyncMutex_Operations, handler_resumes_on_its_context)
+{
+    sync::thread_pool tp(1);
+    sync::task_context tc;
+    sync::async_mutex mutex;
+
+    bool onContext = false;
+
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.async_lock(tc, [&]() { onContext = tc.running_in_this_thread(); mutex.unlock(); });
+
+    (void)sync::post(tp, [&]() { mutex.unlock(); }).get();    // released from a pool thread
+
+    tc.run();
+    EXPECT_TRUE(onContext);
+    EXPECT_FALSE(mutex.locked());
+}
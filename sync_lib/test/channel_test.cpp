@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "sync/channel.hpp"
+#include "sync/task_context.hpp"
+#include "sync/thread_pool.hpp"
+
+
+TEST(SyncChannel_Operations, spsc_fifo_and_capacity)
+{
+    sync::spsc_channel<int> ch(3);     // rounded to 4
+
+    EXPECT_EQ(ch.capacity(), 4);
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(ch.try_send(i));
+
+    EXPECT_FALSE(ch.try_send(4));
+    EXPECT_EQ(ch.size_approx(), 4);
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(ch.try_receive(), i);
+
+    EXPECT_FALSE(ch.try_receive().has_value());
+}
+
+
+TEST(SyncChannel_Operations, batch)
+{
+    sync::spsc_channel<std::string> spsc(8);
+    sync::mpmc_channel<std::string> mpmc(8);
+
+    std::vector<std::string> input = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+
+    std::vector<std::string> copy = input;
+
+    EXPECT_EQ(spsc.try_send_batch(copy.begin(), copy.end()), 8);
+    EXPECT_EQ(copy[8], "i");    // not sent, left untouched
+
+    copy = input;
+    EXPECT_EQ(mpmc.try_send_batch(copy.begin(), copy.end()), 8);
+
+    std::vector<std::string> output;
+    EXPECT_EQ(spsc.try_receive_batch(std::back_inserter(output), 5), 5);
+    EXPECT_EQ(spsc.try_receive_batch(std::back_inserter(output), 5), 3);
+    EXPECT_EQ(output, std::vector<std::string>(input.begin(), input.begin() + 8));
+
+    output.clear();
+    EXPECT_EQ(mpmc.try_receive_batch(std::back_inserter(output), 10), 8);
+    EXPECT_EQ(output, std::vector<std::string>(input.begin(), input.begin() + 8));
+}
+
+
+TEST(SyncChannel_Operations, close)
+{
+    sync::mpmc_channel<int> ch(4);
+
+    EXPECT_TRUE(ch.try_send(1));
+    ch.close();
+
+    EXPECT_TRUE(ch.closed());
+    EXPECT_FALSE(ch.try_send(2));
+    EXPECT_EQ(ch.try_receive(), 1);    // sent before close
+    EXPECT_FALSE(ch.try_receive().has_value());
+}
+
+
+TEST(SyncChannel_Concurrency, mpmc_every_value_once)
+{
+    constexpr int producers     = 4;
+    constexpr int consumers     = 4;
+    constexpr int per_producer  = 20000;
+
+    sync::mpmc_channel<int> ch(64);
+    std::atomic<long long> sum      = 0;
+    std::atomic<int> received       = 0;
+
+    std::vector<std::jthread> threads;
+
+    for (int p = 0; p < producers; ++p)
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; ++i)
+                while (!ch.try_send(p * per_producer + i))
+                    std::this_thread::yield();
+        });
+
+    for (int c = 0; c < consumers; ++c)
+        threads.emplace_back([&]() {
+            while (received < producers * per_producer)
+            {
+                if (auto value = ch.try_receive())
+                {
+                    sum += *value;
+                    ++received;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    threads.clear();
+
+    long long total = static_cast<long long>(producers) * per_producer;
+    EXPECT_EQ(received, total);
+    EXPECT_EQ(sum, total * (total - 1) / 2);
+}
+
+
+TEST(SyncChannel_Concurrency, spsc_order)
+{
+    constexpr int count = 100000;
+
+    sync::spsc_channel<int> ch(16);
+    bool ordered = true;
+
+    std::jthread consumer([&]() {
+        for (int expected = 0; expected < count; )
+        {
+            if (auto value = ch.try_receive())
+                ordered &= (*value == expected++);
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    for (int i = 0; i < count; ++i)
+        while (!ch.try_send(i))
+            std::this_thread::yield();
+
+    consumer.join();
+    EXPECT_TRUE(ordered);
+}
+
+
+TEST(SyncChannel_Executor, async_receive_value_ready)
+{
+    sync::task_context tc;
+    sync::mpmc_channel<int> ch(4);
+    std::optional<int> received;
+
+    EXPECT_TRUE(ch.try_send(7));
+    ch.async_receive(tc, [&](std::optional<int> value) { received = value; });
+
+    EXPECT_FALSE(received.has_value());    // runs on the context, not inline
+    tc.run();
+    EXPECT_EQ(received, 7);
+}
+
+
+TEST(SyncChannel_Executor, async_receive_refused_keeps_value)
+{
+    sync::task_context tc(sync::queue_options{.capacity = 1});
+    sync::mpmc_channel<int> ch(4);
+    std::optional<int> received;
+
+    sync::post_detached(tc, [](){});    // queue is full
+    EXPECT_TRUE(ch.try_send(7));
+
+    EXPECT_THROW(ch.async_receive(tc, [&](std::optional<int> value) { received = value; }), std::system_error);
+    EXPECT_EQ(ch.size_approx(), 1);
+
+    tc.run();
+    ch.async_receive(tc, [&](std::optional<int> value) { received = value; });
+    tc.run();
+
+    EXPECT_EQ(received, 7);
+}
+
+
+TEST(SyncChannel_Executor, waiting_handler_refused_is_reported)
+{
+    std::vector<std::exception_ptr> errors;
+    sync::task_context tc(sync::queue_options{.exception_handler = [&](std::exception_ptr error) { errors.push_back(error); }});
+    sync::mpmc_channel<int> ch(4);
+    bool called = false;
+
+    ch.async_receive(tc, [&](std::optional<int>) { called = true; });
+    tc.stop();
+
+    EXPECT_TRUE(ch.try_send(7));       // the handler cannot be resumed, the value stays
+
+    ASSERT_EQ(errors.size(), 1);
+    EXPECT_THROW(std::rethrow_exception(errors[0]), std::system_error);
+    EXPECT_FALSE(called);
+    EXPECT_EQ(ch.try_receive(), 7);
+}
+
+
+TEST(SyncChannel_Executor, async_receive_resumes_on_pool)
+{
+    sync::thread_pool tp(2);
+    sync::mpmc_channel<int> ch(4);
+
+    std::promise<int> total;
+    int sum = 0;
+
+    // Stage: add values until the channel is closed
+    std::function<void(std::optional<int>)> stage = [&](std::optional<int> value) {
+        if (!value)
+        {
+            total.set_value(tp.running_in_this_thread() ? sum : -1);
+            return;
+        }
+
+        sum += *value;
+        ch.async_receive(tp, stage);
+    };
+
+    ch.async_receive(tp, stage);
+
+    for (int i = 1; i <= 100; ++i)
+    {
+        while (!ch.try_send(i))
+            std::this_thread::yield();
+
+        if (i % 10 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));    // let the stage wait for data
+    }
+
+    ch.close();
+
+    EXPECT_EQ(total.get_future().get(), 5050);
+}
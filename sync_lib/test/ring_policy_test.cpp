@@ -0,0 +1,279 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "sync/task_context.hpp"
+#include "sync/thread_pool.hpp"
+
+
+// Ordering tests
+// ===========================================================
+TEST(SyncRingPolicy_Order, priority_bands)
+{
+    sync::ring_task_context tc;
+    std::vector<sync::priority> order;
+
+    for (auto prio : {sync::priority::lowest, sync::priority::medium, sync::priority::low, sync::priority::highest, sync::priority::high})
+        sync::post_detached(tc, prio, [&order, prio]() { order.push_back(prio); });
+
+    tc.run();
+
+    std::vector<sync::priority> expected = {sync::priority::highest, sync::priority::high, sync::priority::medium,
+                                            sync::priority::low, sync::priority::lowest};
+
+    EXPECT_EQ(order, expected);
+    EXPECT_EQ(tc.jobs_done(), 5);
+}
+
+
+TEST(SyncRingPolicy_Order, fifo_ring_ignores_priority)
+{
+    sync::fifo_ring_task_context tc;
+    std::vector<int> order;
+
+    sync::post_detached(tc, sync::priority::lowest, [&]() { order.push_back(0); });
+    sync::post_detached(tc, sync::priority::highest, [&]() { order.push_back(1); });
+    sync::post_detached(tc, [&]() { order.push_back(2); });
+
+    auto result = sync::post(tc, [](int a, int b) { return a + b; }, 2, 3);
+
+    tc.run();
+
+    EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(result.get(), 5);
+}
+
+
+// Capacity tests
+// ===========================================================
+TEST(SyncRingPolicy_Bounded, reject_when_full)
+{
+    sync::fifo_ring_task_context tc(sync::queue_options{.capacity = 4});
+
+    for (int i = 0; i < 4; ++i)
+        (void)sync::post(tc, [](){});
+
+    EXPECT_THROW((void)sync::post(tc, [](){}), std::system_error);
+    EXPECT_FALSE(sync::try_post(tc, [](){}).has_value());
+    EXPECT_EQ(tc.rejected_posts(), 2);
+
+    tc.run();
+
+    EXPECT_TRUE(sync::try_post(tc, [](){}).has_value());
+}
+
+
+TEST(SyncRingPolicy_Bounded, total_over_bands)
+{
+    sync::ring_task_context tc(sync::queue_options{.capacity = 3}.limit(sync::priority::low, 1));
+
+    (void)sync::post(tc, sync::priority::high, [](){});
+    (void)sync::post(tc, sync::priority::low, [](){});
+
+    EXPECT_FALSE(sync::try_post(tc, sync::priority::low, [](){}).has_value());   // band full
+    (void)sync::post(tc, sync::priority::medium, [](){});
+
+    // Total reached while every ring has free slots
+    EXPECT_THROW((void)sync::post(tc, sync::priority::highest, [](){}), std::system_error);
+    EXPECT_FALSE(sync::try_post(tc, sync::priority::lowest, [](){}).has_value());
+    EXPECT_EQ(tc.rejected_posts(), 3);
+
+    tc.run();
+
+    EXPECT_EQ(tc.jobs_done(), 3);
+    EXPECT_TRUE(sync::try_post(tc, sync::priority::low, [](){}).has_value());
+}
+
+
+TEST(SyncRingPolicy_Bounded, capacity_below_ring_size)
+{
+    sync::fifo_ring_task_context tc(sync::queue_options{.capacity = 1});
+
+    (void)sync::post(tc, [](){});
+
+    EXPECT_THROW((void)sync::post(tc, [](){}), std::system_error);
+}
+
+
+TEST(SyncRingPolicy_Bounded, block_until_space)
+{
+    sync::fifo_ring_thread_pool tp(1, sync::queue_options{.capacity = 2, .overflow = sync::overflow_policy::block});
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    (void)sync::post(tp, [released]() { released.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));    // the worker takes the first job
+    (void)sync::post(tp, [](){});
+    (void)sync::post(tp, [](){});                                  // ring full
+
+    std::thread producer([&]() { (void)sync::post(tp, [](){}); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    release.set_value();
+    producer.join();
+
+    tp.join();
+
+    EXPECT_EQ(tp.blocked_posts(), 1);
+    EXPECT_EQ(tp.jobs_done(), 4);
+}
+
+
+TEST(SyncRingPolicy_Bounded, caller_runs_expired)
+{
+    sync::fifo_ring_task_context tc(sync::queue_options{.capacity = 2, .overflow = sync::overflow_policy::caller_runs});
+
+    for (int i = 0; i < 2; ++i)
+        (void)sync::post(tc, [](){});
+
+    auto expired = sync::post(tc, std::chrono::steady_clock::now() - std::chrono::milliseconds(1), []() { return 1; });
+
+    EXPECT_THROW(expired.get(), std::future_error);
+    EXPECT_EQ(tc.deadline_misses(), 1);
+    EXPECT_EQ(tc.jobs_done(), 0);
+}
+
+
+// Execution context rules
+// ===========================================================
+TEST(SyncRingPolicy_Context, reserved_workers_refused)
+{
+    auto options = sync::queue_options{}.reserve(sync::priority::high, 1);
+
+    EXPECT_THROW(sync::ring_thread_pool(4, options), std::invalid_argument);
+    EXPECT_THROW(sync::fifo_ring_task_context{options}, std::invalid_argument);
+}
+
+
+TEST(SyncRingPolicy_Context, stop_keeps_pending_jobs)
+{
+    sync::ring_task_context tc;
+    size_t executed = 0;
+
+    sync::post_detached(tc, sync::priority::highest, [&]() { ++executed; tc.stop(); });
+
+    for (int i = 0; i < 9; ++i)
+        sync::post_detached(tc, [&]() { ++executed; });
+
+    tc.run();
+    EXPECT_EQ(executed, 1);
+
+    tc.restart();
+    tc.run();
+    EXPECT_EQ(executed, 10);
+}
+
+
+TEST(SyncRingPolicy_Context, defer_and_dispatch)
+{
+    sync::ring_thread_pool tp(2);
+    std::vector<int> order;
+
+    auto done = sync::post(tp, [&]() {
+        sync::defer(tp, [&]() { order.push_back(2); });
+        (void)sync::dispatch(tp, [&]() { order.push_back(0); });
+        order.push_back(1);
+    });
+
+    done.get();
+    tp.join();
+
+    EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+}
+
+
+TEST(SyncRingPolicy_Context, wake_parked_workers)
+{
+    sync::ring_thread_pool tp(2);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));    // workers go back to the parked state
+
+        auto result = sync::post(tp, [i]() { return i; });
+
+        ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        EXPECT_EQ(result.get(), i);
+    }
+}
+
+
+// Linearizability under contention
+// ===========================================================
+TEST(SyncRingPolicy_Stress, every_job_once_in_order)
+{
+    constexpr int producers     = 4;
+    constexpr int jobsEach      = 20'000;
+    constexpr int workers       = 4;
+
+    // Small ring: producers block, workers park and wake often
+    sync::fifo_ring_thread_pool tp(workers, sync::queue_options{.capacity = 64, .overflow = sync::overflow_policy::block});
+
+    std::vector<std::atomic_int> runs(producers * jobsEach);
+    std::atomic_int outOfOrder = 0;
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p)
+        threads.emplace_back([&, p]() {
+            for (int seq = 0; seq < jobsEach; ++seq)
+                sync::post_detached(tp, [&, p, seq]() {
+                    // A worker runs jobs in dequeue order: for each producer, it must see increasing sequence numbers
+                    thread_local std::vector<int> lastSeen;
+
+                    if (lastSeen.empty())
+                        lastSeen.assign(producers, -1);
+
+                    if (seq <= lastSeen[p])
+                        ++outOfOrder;
+
+                    lastSeen[p] = seq;
+                    ++runs[p * jobsEach + seq];
+                });
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    tp.join();
+
+    EXPECT_EQ(tp.jobs_done(), producers * jobsEach);
+    EXPECT_EQ(outOfOrder, 0);
+
+    for (size_t i = 0; i < runs.size(); ++i)
+        ASSERT_EQ(runs[i], 1) << "job " << i;
+}
+
+
+TEST(SyncRingPolicy_Stress, bands_under_contention)
+{
+    constexpr int producers = 4;
+    constexpr int jobsEach  = 10'000;
+
+    sync::ring_thread_pool tp(3, sync::queue_options{.capacity = 128, .overflow = sync::overflow_policy::block});
+
+    std::atomic_int executed = 0;
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p)
+        threads.emplace_back([&, p]() {
+            auto prio = p % 2 == 0 ? sync::priority::high : sync::priority::low;
+
+            for (int i = 0; i < jobsEach; ++i)
+                sync::post_detached(tp, prio, [&]() { ++executed; });
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    tp.join();
+
+    EXPECT_EQ(executed, producers * jobsEach);
+    EXPECT_EQ(tp.jobs_done(), producers * jobsEach);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "sync/slab_resource.hpp"
+#include "sync/thread_pool.hpp"
+
+
+// Members tests
+// ===========================================================
+TEST(SyncSlabResource_Operations, reuse_local_block)
+{
+    std::pmr::memory_resource* resource = sync::default_slab_resource();
+
+    void* first = resource->allocate(48);
+    resource->deallocate(first, 48);
+    void* second = resource->allocate(40);    // same size class
+
+    EXPECT_EQ(first, second);
+    resource->deallocate(second, 40);
+}
+
+
+TEST(SyncSlabResource_Operations, alignment)
+{
+    std::pmr::memory_resource* resource = sync::default_slab_resource();
+
+    for (size_t bytes : {1, 16, 24, 100, 512, 513, 4096})
+    {
+        void* ptr = resource->allocate(bytes);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t), 0);
+        resource->deallocate(ptr, bytes);
+    }
+
+    void* overAligned = resource->allocate(64, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(overAligned) % 64, 0);
+    resource->deallocate(overAligned, 64, 64);
+}
+
+
+TEST(SyncSlabResource_Operations, is_equal)
+{
+    sync::slab_resource other;
+
+    EXPECT_TRUE(sync::default_slab_resource()->is_equal(other));
+    EXPECT_FALSE(sync::default_slab_resource()->is_equal(*std::pmr::new_delete_resource()));
+}
+
+
+TEST(SyncSlabResource_Operations, cross_thread_free_returns_to_owner)
+{
+    constexpr size_t count = 1000;
+    std::pmr::memory_resource* resource = sync::default_slab_resource();
+
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < count; ++i)
+        blocks.push_back(resource->allocate(500));
+
+    // Free everything from another thread (batches are returned at the latest on thread exit)
+    std::thread([&]() {
+        for (void* ptr : blocks)
+            resource->deallocate(ptr, 500);
+    }).join();
+
+    std::set<void*> previous(blocks.begin(), blocks.end());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        blocks[i] = resource->allocate(500);
+        EXPECT_TRUE(previous.count(blocks[i]) == 1);
+    }
+
+    for (void* ptr : blocks)
+        resource->deallocate(ptr, 500);
+}
+
+
+TEST(SyncSlabResource_Operations, thread_pool_resource)
+{
+    sync::thread_pool tp(2, sync::queue_options{.task_resource = std::pmr::new_delete_resource()});
+
+    std::array<char, 1024> big = {};
+    big[1023] = 7;
+
+    auto small_result   = sync::post(tp, [](int a) { return a * 2; }, 21);
+    auto big_result     = sync::post(tp, [big]() { return big[1023]; });     // does not fit inline
+
+    EXPECT_EQ(small_result.get(), 42);
+    EXPECT_EQ(big_result.get(), 7);
+}
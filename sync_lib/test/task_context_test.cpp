@@ -3,6 +3,11 @@
 
 #include "sync/task_context.hpp"
 
+#ifdef SYNC_HAS_EPOLL
+#   include <sys/socket.h>
+#   include <unistd.h>
+#endif  // SYNC_HAS_EPOLL
+
 
 // Members tests
 // ===========================================================
@@ -58,3 +63,529 @@ TEST_F(SyncTaskContext_Operations, post_and_run)
 
     EXPECT_EQ(execution_order, expected_order);
 }
+
+
+// Bounded queue tests
+// ===========================================================
+TEST(SyncTaskContext_Bounded, reject_when_full)
+{
+    sync::task_context tc(sync::queue_options{.capacity = 2});
+
+    (void)sync::post(tc, [](){});
+    (void)sync::post(tc, [](){});
+
+    EXPECT_THROW((void)sync::post(tc, [](){}), std::system_error);
+    EXPECT_EQ(tc.rejected_posts(), 1);
+
+    tc.run();
+
+    EXPECT_NO_THROW((void)sync::post(tc, [](){}));
+}
+
+
+TEST(SyncTaskContext_Bounded, try_post)
+{
+    sync::task_context tc(sync::queue_options{.capacity = 1});
+
+    auto accepted = sync::try_post(tc, []() { return 42; });
+    auto refused  = sync::try_post(tc, []() { return 0; });
+
+    ASSERT_TRUE(accepted.has_value());
+    EXPECT_FALSE(refused.has_value());
+    EXPECT_EQ(tc.rejected_posts(), 1);
+
+    tc.run();
+
+    EXPECT_EQ(accepted->get(), 42);
+
+    tc.stop();
+    EXPECT_FALSE(sync::try_post(tc, [](){}).has_value());
+}
+
+
+TEST(SyncTaskContext_Bounded, priority_capacity)
+{
+    sync::task_context tc(sync::queue_options{}.limit(sync::priority::low, 1));
+
+    (void)sync::post(tc, sync::priority::low, [](){});
+
+    EXPECT_THROW((void)sync::post(tc, sync::priority::low, [](){}), std::system_error);
+    EXPECT_NO_THROW((void)sync::post(tc, sync::priority::high, [](){}));
+    EXPECT_EQ(tc.rejected_posts(), 1);
+}
+
+
+TEST(SyncTaskContext_Bounded, caller_runs)
+{
+    sync::task_context tc(sync::queue_options{.capacity = 1, .overflow = sync::overflow_policy::caller_runs});
+    std::vector<int> execution_order;
+
+    (void)sync::post(tc, [&]() { execution_order.push_back(1); });
+    (void)sync::post(tc, [&]() { execution_order.push_back(2); });  // queue is full, runs now
+
+    EXPECT_EQ(execution_order, std::vector<int>({2}));
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({2, 1}));
+    EXPECT_EQ(tc.rejected_posts(), 0);
+}
+
+
+TEST(SyncTaskContext_Bounded, block_timeout)
+{
+    sync::task_context tc(sync::queue_options{  .capacity = 1,
+                                                .overflow = sync::overflow_policy::block,
+                                                .block_timeout = std::chrono::milliseconds(50)});
+
+    (void)sync::post(tc, [](){});
+
+    EXPECT_THROW((void)sync::post(tc, [](){}), std::system_error);   // nobody runs the context
+    EXPECT_EQ(tc.blocked_posts(), 1);
+    EXPECT_EQ(tc.rejected_posts(), 1);
+}
+
+
+// Scheduling policy tests
+// ===========================================================
+TEST(SyncTaskContext_Policy, fifo)
+{
+    sync::fifo_task_context tc;
+    std::vector<int> execution_order;
+
+    (void)sync::post(tc, sync::priority::lowest, [&]() { execution_order.push_back(1); });
+    (void)sync::post(tc, sync::priority::highest, [&]() { execution_order.push_back(2); });
+    (void)sync::post(tc, sync::priority::medium, [&]() { execution_order.push_back(3); });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2, 3}));
+}
+
+
+TEST(SyncTaskContext_Policy, lifo)
+{
+    sync::lifo_task_context tc;
+    std::vector<int> execution_order;
+
+    (void)sync::post(tc, [&]() { execution_order.push_back(1); });
+    (void)sync::post(tc, [&]() { execution_order.push_back(2); });
+    (void)sync::post(tc, [&]() { execution_order.push_back(3); });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({3, 2, 1}));
+}
+
+
+TEST(SyncTaskContext_Policy, edf)
+{
+    sync::edf_task_context tc;
+    std::vector<int> execution_order;
+    auto now = std::chrono::steady_clock::now();
+
+    (void)sync::post(tc, [&]() { execution_order.push_back(4); });     // no deadline, runs last
+    (void)sync::post(tc, now + std::chrono::seconds(3), [&]() { execution_order.push_back(3); });
+    (void)sync::post(tc, now + std::chrono::seconds(1), [&]() { execution_order.push_back(1); });
+    (void)sync::post(tc, now + std::chrono::seconds(2), [&]() { execution_order.push_back(2); });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2, 3, 4}));
+}
+
+
+// Deadline tests
+// ===========================================================
+TEST(SyncTaskContext_Deadline, drop_expired)
+{
+    std::vector<sync::priority> missed;
+    sync::task_context tc(sync::queue_options{.deadline_miss_handler = [&](sync::priority prio) { missed.push_back(prio); }});
+
+    auto now = std::chrono::steady_clock::now();
+
+    auto expired    = sync::post(tc, sync::priority::low, now - std::chrono::milliseconds(1), []() { return 1; });
+    auto valid      = sync::post(tc, sync::priority::low, now + std::chrono::seconds(10), []() { return 2; });
+    auto no_limit   = sync::post(tc, []() { return 3; });
+
+    tc.run();
+
+    EXPECT_EQ(valid.get(), 2);
+    EXPECT_EQ(no_limit.get(), 3);
+    EXPECT_THROW(expired.get(), std::future_error);
+
+    EXPECT_EQ(tc.deadline_misses(), 1);
+    EXPECT_EQ(tc.deadline_misses(sync::priority::low), 1);
+    EXPECT_EQ(tc.deadline_misses(sync::priority::high), 0);
+    EXPECT_EQ(missed, std::vector<sync::priority>({sync::priority::low}));
+}
+
+
+TEST(SyncTaskContext_Deadline, priority_order)
+{
+    sync::task_context tc;
+    std::vector<int> execution_order;
+    auto now = std::chrono::steady_clock::now();
+
+    // deadline comes before the medium job ages to highest priority
+    (void)sync::post(tc, sync::priority::medium, [&]() { execution_order.push_back(3); });
+    (void)sync::post(tc, sync::priority::lowest, now + std::chrono::seconds(20), [&]() { execution_order.push_back(2); });
+    (void)sync::post(tc, sync::priority::lowest, now + std::chrono::seconds(10), [&]() { execution_order.push_back(1); });
+    (void)sync::post(tc, sync::priority::lowest, [&]() { execution_order.push_back(4); });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2, 3, 4}));
+}
+
+
+TEST(SyncTaskContext_Deadline, caller_runs_expired)
+{
+    std::vector<sync::priority> missed;
+    sync::task_context tc(sync::queue_options{  .capacity = 1,
+                                                .overflow = sync::overflow_policy::caller_runs,
+                                                .deadline_miss_handler = [&](sync::priority prio) { missed.push_back(prio); }});
+
+    (void)sync::post(tc, [](){});
+
+    // Queue is full: the caller would run it, but it is already too late
+    auto expired = sync::post(tc, sync::priority::high, std::chrono::steady_clock::now() - std::chrono::milliseconds(1), []() { return 1; });
+
+    EXPECT_THROW(expired.get(), std::future_error);
+    EXPECT_EQ(tc.deadline_misses(sync::priority::high), 1);
+    EXPECT_EQ(missed, std::vector<sync::priority>({sync::priority::high}));
+}
+
+
+TEST(SyncTaskContext_Deadline, dispatch_expired)
+{
+    sync::task_context tc;
+    bool executed = false;
+
+    sync::post_detached(tc, [&]() {
+        auto past = sync::detail::priority_job::clock_type::now() - std::chrono::milliseconds(1);
+
+        // Would run inline, but it is already too late
+        tc.get_executor().dispatch(sync::detail::priority_job(sync::priority::low, past, [&]() { executed = true; }));
+    });
+
+    tc.run();
+
+    EXPECT_FALSE(executed);
+    EXPECT_EQ(tc.deadline_misses(sync::priority::low), 1);
+    EXPECT_EQ(tc.jobs_done(), 1);
+}
+
+
+// Detached tasks tests
+// ===========================================================
+TEST(SyncTaskContext_Detached, post_detached)
+{
+    std::vector<int> execution_order;
+    sync::task_context tc;
+
+    sync::post_detached(tc, sync::priority::low, [&](int value) { execution_order.push_back(value); }, 2);
+    sync::post_detached(tc, sync::priority::high, [&]() { execution_order.push_back(1); });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2}));
+}
+
+
+TEST(SyncTaskContext_Detached, exception_handler)
+{
+    std::vector<std::string> errors;
+    sync::task_context tc(sync::queue_options{.exception_handler = [&](std::exception_ptr error) {
+                                                    try { std::rethrow_exception(error); }
+                                                    catch (const std::exception& e) { errors.push_back(e.what()); }
+                                                }});
+
+    sync::post_detached(tc, []() { throw std::out_of_range("detached"); });
+    sync::post_detached(tc, [](){});
+
+    tc.run();
+
+    EXPECT_EQ(errors, std::vector<std::string>({"detached"}));
+}
+
+
+TEST(SyncTaskContext_Detached, defer_runs_after_current_job)
+{
+    std::vector<int> execution_order;
+    sync::task_context tc;
+
+    sync::post_detached(tc, sync::priority::low, [&]() {
+        // Continuation runs right after this job, before the queued high priority job
+        sync::defer(tc, [&]() { execution_order.push_back(2); });
+        sync::post_detached(tc, sync::priority::highest, [&]() { execution_order.push_back(3); });
+        execution_order.push_back(1);
+    });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2, 3}));
+}
+
+
+TEST(SyncTaskContext_Detached, defer_from_outside)
+{
+    int value = 0;
+    sync::task_context tc;
+
+    sync::defer(tc, [&]() { value = 1; });  // not running, queued
+
+    EXPECT_EQ(value, 0);
+    tc.run();
+    EXPECT_EQ(value, 1);
+}
+
+
+TEST(SyncTaskContext_Dispatch, inline_when_running)
+{
+    std::vector<int> execution_order;
+    sync::task_context tc;
+
+    EXPECT_FALSE(tc.running_in_this_thread());
+
+    sync::post_detached(tc, [&]() {
+        EXPECT_TRUE(tc.running_in_this_thread());
+
+        // Runs before dispatch() returns
+        auto result = sync::dispatch(tc, [&]() { execution_order.push_back(1); return 5; });
+        EXPECT_EQ(result.get(), 5);
+        execution_order.push_back(2);
+    });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 2}));
+    EXPECT_EQ(tc.jobs_done(), 2);
+}
+
+
+TEST(SyncTaskContext_Dispatch, queued_from_outside)
+{
+    sync::task_context tc;
+
+    auto result = sync::dispatch(tc, [](int a, int b) { return a + b; }, 2, 3);
+
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+    tc.run();
+    EXPECT_EQ(result.get(), 5);
+}
+
+
+TEST(SyncTaskContext_Dispatch, bounded_recursion)
+{
+    size_t maxDepth = 0;
+    size_t depth    = 0;
+    sync::task_context tc;
+
+    std::function<void()> recurse = [&]() {
+        maxDepth = std::max(maxDepth, ++depth);
+
+        if (tc.jobs_done() < 200)
+            (void)sync::dispatch(tc, recurse);
+
+        --depth;
+    };
+
+    (void)sync::dispatch(tc, recurse);
+    tc.run();
+
+    EXPECT_LE(maxDepth, sync::detail::call_stack::max_dispatch_depth + 1);
+    EXPECT_GE(tc.jobs_done(), 200);
+}
+
+
+
+// Batched dequeue tests
+// ===========================================================
+TEST(SyncTaskContext_Batch, deep_queue_keeps_priority_order)
+{
+    const sync::priority levels[] = {sync::priority::highest, sync::priority::high, sync::priority::medium,
+                                     sync::priority::low, sync::priority::lowest};
+    sync::task_context tc;
+    std::vector<sync::priority> order;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        auto prio = levels[(i * 7) % 5];
+        sync::post_detached(tc, prio, [&order, prio]() { order.push_back(prio); });
+    }
+
+    tc.run();
+
+    ASSERT_EQ(order.size(), 200);
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+    EXPECT_EQ(tc.jobs_done(), 200);
+}
+
+
+TEST(SyncTaskContext_Batch, stop_keeps_jobs_not_started)
+{
+    sync::task_context tc;
+    size_t executed = 0;
+
+    sync::post_detached(tc, sync::priority::highest, [&]() { ++executed; tc.stop(); });
+
+    for (int i = 0; i < 99; ++i)
+        sync::post_detached(tc, [&]() { ++executed; });
+
+    tc.run();
+
+    EXPECT_EQ(executed, 1);
+    EXPECT_EQ(tc.jobs_done(), 1);
+
+    tc.restart();
+    tc.run();
+
+    EXPECT_EQ(executed, 100);
+    EXPECT_EQ(tc.jobs_done(), 100);
+}
+
+
+TEST(SyncTaskContext_Batch, batched_jobs_count_against_capacity)
+{
+    sync::task_context tc(sync::queue_options{.capacity = 100});
+    size_t accepted = 0;
+
+    // The first job runs while the rest of its batch waits: only the slot of the running job is free
+    sync::post_detached(tc, sync::priority::highest, [&]() {
+        for (int i = 0; i < 20; ++i)
+            accepted += sync::try_post(tc, [](){}).has_value() ? 1 : 0;
+    });
+
+    for (int i = 0; i < 99; ++i)
+        sync::post_detached(tc, [](){});
+
+    tc.run();
+
+    EXPECT_EQ(accepted, 1);
+    EXPECT_EQ(tc.jobs_done(), 101);
+}
+
+
+TEST(SyncTaskContext_Affinity, key_ignored)
+{
+    sync::task_context tc;
+    int sum = 0;
+
+    auto result = sync::post(tc, sync::affinity(1), [](int a, int b) { return a + b; }, 2, 3);
+    sync::post_detached(tc, sync::priority::low, sync::affinity(std::string("shard")), [&]() { sum += 5; });
+
+    tc.run();
+
+    EXPECT_EQ(result.get(), 5);
+    EXPECT_EQ(sum, 5);
+}
+
+#ifdef SYNC_HAS_EPOLL
+TEST(SyncTaskContext_Reactor, pipe_readable)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::string received;
+    sync::io_event ready = sync::io_event::none;
+    sync::task_context tc;
+
+    tc.watch(fds[0], sync::io_event::readable, [&](sync::io_event events) {
+        char buffer[16];
+        ssize_t n = ::read(fds[0], buffer, sizeof(buffer));
+        received.append(buffer, n);
+        ready = events;
+        tc.unwatch(fds[0]);     // run() returns after this
+    });
+
+    ASSERT_EQ(::write(fds[1], "abc", 3), 3);
+    tc.run();
+
+    EXPECT_EQ(received, "abc");
+    EXPECT_TRUE(sync::has_event(ready, sync::io_event::readable));
+    EXPECT_EQ(tc.jobs_done(), 1);
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+
+TEST(SyncTaskContext_Reactor, handlers_and_jobs_share_run)
+{
+    int fds[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    std::vector<int> execution_order;
+    sync::task_context tc;
+
+    tc.watch(fds[0], sync::io_event::readable, [&](sync::io_event) {
+        char value;
+        ASSERT_EQ(::read(fds[0], &value, 1), 1);
+        execution_order.push_back(value);
+
+        if (value == 2)
+            tc.unwatch(fds[0]);
+        else    // next message comes from a posted job
+            sync::post_detached(tc, [&]() { execution_order.push_back(0); (void)::write(fds[1], "\x02", 1); });
+    });
+
+    std::jthread writer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));     // run() is waiting in the reactor
+        (void)::write(fds[1], "\x01", 1);
+    });
+
+    tc.run();
+
+    EXPECT_EQ(execution_order, std::vector<int>({1, 0, 2}));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+
+TEST(SyncTaskContext_Reactor, post_and_stop_wake_run)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    bool posted = false;
+    sync::task_context tc;
+
+    tc.watch(fds[0], sync::io_event::readable, [](sync::io_event) {});     // never ready
+
+    std::jthread other([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        sync::post_detached(tc, [&]() { posted = true; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        tc.stop();
+    });
+
+    tc.run();   // returns on stop()
+
+    EXPECT_TRUE(posted);
+    EXPECT_TRUE(tc.unwatch(fds[0]));
+    EXPECT_FALSE(tc.unwatch(fds[0]));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+
+TEST(SyncTaskContext_Reactor, watch_errors)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    sync::task_context tc;
+
+    EXPECT_THROW(tc.watch(-1, sync::io_event::readable, [](sync::io_event) {}), std::system_error);
+
+    tc.watch(fds[0], sync::io_event::readable, [](sync::io_event) {});
+    EXPECT_THROW(tc.watch(fds[0], sync::io_event::readable, [](sync::io_event) {}), std::system_error);
+    EXPECT_TRUE(tc.unwatch(fds[0]));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+#endif  // SYNC_HAS_EPOLL
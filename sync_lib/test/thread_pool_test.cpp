@@ -1,8 +1,16 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <map>
+#include <set>
+
 #include "sync/thread_pool.hpp"
 
+#ifdef SYNC_HAS_EPOLL
+#   include <sys/socket.h>
+#   include <unistd.h>
+#endif  // SYNC_HAS_EPOLL
+
 
 // Helpers
 // ===========================================================
@@ -93,3 +101,245 @@ TEST_F(SyncThreadPool_Operations, stop)
 
     EXPECT_EQ(this->_thread_pool_instance.jobs_done(), 1);
 }
+
+
+TEST(SyncThreadPool_Bounded, block_until_space)
+{
+    sync::thread_pool tp(1, sync::queue_options{.capacity = 1, .overflow = sync::overflow_policy::block});
+
+    (void)sync::post(tp, _test_no_return_no_except);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // wait for pool to start the first task
+    (void)sync::post(tp, _test_no_return_no_except);             // fills the queue
+    auto result = sync::post(tp, _test_no_return_no_except);     // waits for the second task to start
+
+    EXPECT_NO_THROW(result.get());
+    tp.join();
+
+    EXPECT_EQ(tp.blocked_posts(), 1);
+    EXPECT_EQ(tp.rejected_posts(), 0);
+    EXPECT_EQ(tp.jobs_done(), 3);
+}
+
+
+TEST(SyncThreadPool_Policy, fifo_pool)
+{
+    sync::fifo_thread_pool tp(2);
+
+    auto result = sync::post(tp, [](int a, int b) { return a + b; }, 2, 3);
+
+    EXPECT_EQ(result.get(), 5);
+}
+
+
+TEST(SyncThreadPool_Dispatch, inline_on_worker)
+{
+    sync::thread_pool tp(2);
+
+    EXPECT_FALSE(tp.running_in_this_thread());
+
+    auto result = sync::post(tp, [&]() {
+        std::thread::id inner = sync::dispatch(tp, []() { return std::this_thread::get_id(); }).get();
+        return tp.running_in_this_thread() && inner == std::this_thread::get_id();
+    });
+
+    EXPECT_TRUE(result.get());
+}
+
+
+
+TEST(SyncThreadPool_Reserved, high_priority_not_blocked_by_flood)
+{
+    sync::thread_pool tp(2, sync::queue_options{}.reserve(sync::priority::high, 1));
+
+    std::atomic_int active      = 0;
+    std::atomic_int maxActive   = 0;
+
+    auto bulk = [&]() {
+        int now = ++active;
+        int seen = maxActive;
+
+        while (now > seen && !maxActive.compare_exchange_weak(seen, now)) { /* retry */ }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        --active;
+    };
+
+    for (int i = 0; i < 6; ++i)
+        sync::post_detached(tp, sync::priority::low, bulk);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));     // the flood occupies the pool
+
+    auto posted = std::chrono::steady_clock::now();
+    auto started = sync::post(tp, sync::priority::highest, []() { return std::chrono::steady_clock::now(); }).get();
+
+    EXPECT_LT(started - posted, std::chrono::milliseconds(40));     // didn't wait for a bulk job to finish
+    tp.join();
+
+    EXPECT_EQ(maxActive, 1);    // one worker kept for the reserved priority
+    EXPECT_EQ(tp.jobs_done(), 7);
+}
+
+
+TEST(SyncThreadPool_Reserved, reserved_jobs_use_every_worker)
+{
+    sync::thread_pool tp(3, sync::queue_options{}.reserve(sync::priority::high, 1));
+
+    std::atomic_int active      = 0;
+    std::atomic_int maxActive   = 0;
+
+    for (int i = 0; i < 6; ++i)
+        sync::post_detached(tp, sync::priority::high, [&]() {
+            int now = ++active;
+            int seen = maxActive;
+
+            while (now > seen && !maxActive.compare_exchange_weak(seen, now)) { /* retry */ }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            --active;
+        });
+
+    tp.join();
+
+    EXPECT_EQ(maxActive, 3);
+    EXPECT_EQ(tp.jobs_done(), 6);
+}
+
+
+
+TEST(SyncThreadPool_Batch, wait_for_later_job_of_same_batch)
+{
+    sync::thread_pool tp(2);
+
+    std::atomic_int started = 0;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    // Keep both workers busy while the queue fills up
+    for (int i = 0; i < 2; ++i)
+        sync::post_detached(tp, [&, released]() { ++started; released.wait(); });
+
+    while (started < 2)
+        std::this_thread::yield();
+
+    for (int i = 0; i < 60; ++i)
+        sync::post_detached(tp, [](){});
+
+    // Likely dequeued in the same batch, `second` after `first`
+    std::promise<void> secondDone;
+    auto first  = sync::post(tp, [done = secondDone.get_future()]() { return done.wait_for(std::chrono::seconds(5)); });
+    auto second = sync::post(tp, [&]() { secondDone.set_value(); });
+
+    for (int i = 0; i < 60; ++i)
+        sync::post_detached(tp, [](){});
+
+    release.set_value();
+
+    EXPECT_EQ(first.get(), std::future_status::ready);
+    second.get();
+}
+
+
+TEST(SyncThreadPool_Affinity, same_key_same_worker)
+{
+    sync::thread_pool tp(4);
+
+    std::map<int, std::set<std::thread::id>> keyThreads;
+    std::set<std::thread::id> usedThreads;
+
+    for (int round = 0; round < 20; ++round)
+        for (int key = 0; key < 8; ++key)
+        {
+            auto id = sync::post(tp, sync::affinity(key), []() { return std::this_thread::get_id(); }).get();
+
+            keyThreads[key].insert(id);
+            usedThreads.insert(id);
+        }
+
+    for (const auto& [key, threads] : keyThreads)
+        EXPECT_EQ(threads.size(), 1) << "key " << key;
+
+    EXPECT_GT(usedThreads.size(), 1);   // keys spread over the workers
+    EXPECT_EQ(tp.stolen_jobs(), 0);
+}
+
+
+TEST(SyncThreadPool_Affinity, steal_when_behind)
+{
+    sync::thread_pool tp(2, sync::queue_options{.affinity_steal_threshold = 2});
+
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto getId = []() { return std::this_thread::get_id(); };
+
+    auto blocking = sync::post(tp, sync::affinity(7), [&, released]() {
+        started.set_value();
+        released.wait();
+        return std::this_thread::get_id();
+    });
+
+    started.get_future().wait();
+
+    auto second = sync::post(tp, sync::affinity(7), getId);     // stolen once the queue reaches the threshold
+    auto third  = sync::post(tp, sync::affinity(7), getId);     // stolen as well
+    auto fourth = sync::post(tp, sync::affinity(7), getId);     // alone below the threshold, kept for the owner
+
+    ASSERT_EQ(second.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(third.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(fourth.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+    release.set_value();
+
+    std::thread::id owner = blocking.get();
+
+    EXPECT_NE(second.get(), owner);
+    EXPECT_NE(third.get(), owner);
+    EXPECT_EQ(fourth.get(), owner);
+
+    tp.join();
+    EXPECT_EQ(tp.stolen_jobs(), 2);
+}
+
+TEST(SyncThreadPool_Affinity, wait_for_same_key)
+{
+    sync::thread_pool tp(4);
+
+    // The second job waits behind the first on the same worker, an idle worker takes it once the first makes no progress
+    auto first = sync::post(tp, sync::affinity(42), [&tp]() {
+        auto second = sync::post(tp, sync::affinity(42), []() { return true; });
+        return second.wait_for(std::chrono::seconds(5)) == std::future_status::ready && second.get();
+    });
+
+    EXPECT_TRUE(first.get());
+
+    tp.join();
+    EXPECT_EQ(tp.stolen_jobs(), 1);
+}
+
+#ifdef SYNC_HAS_EPOLL
+TEST(SyncThreadPool_Reactor, socket_readable)
+{
+    int fds[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    sync::thread_pool tp(2);
+    std::promise<bool> handled;
+
+    tp.watch(fds[0], sync::io_event::readable, [&](sync::io_event events) {
+        char value;
+        tp.unwatch(fds[0]);
+        handled.set_value(::read(fds[0], &value, 1) == 1 && value == 'x' && tp.running_in_this_thread() &&
+                            sync::has_event(events, sync::io_event::readable));
+    });
+
+    ASSERT_EQ(::write(fds[1], "x", 1), 1);
+
+    EXPECT_TRUE(handled.get_future().get());
+
+    tp.join();
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+#endif  // SYNC_HAS_EPOLL